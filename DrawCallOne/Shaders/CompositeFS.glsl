@@ -0,0 +1,14 @@
+#version 310 es
+
+precision mediump float;
+precision mediump sampler2D;
+
+uniform sampler2D uLayerSampler; // ȭ ũⰡ  ĳ ̾Դϴ.
+
+out vec4 _Color;
+
+void main()
+{
+	// ̾ Ƽö̵ ̹Ƿ GL_ONE, GL_ONE_MINUS_SRC_ALPHA ϴ.
+	_Color = texelFetch(uLayerSampler, ivec2(gl_FragCoord.xy), 0);
+}
\ No newline at end of file
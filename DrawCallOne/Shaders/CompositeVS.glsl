@@ -0,0 +1,9 @@
+#version 310 es
+
+layout (location = 0) in vec2 _PosOrTexCoord;
+
+void main()
+{
+	// Ʈ  0~1 簢 ȭ ü øϴ.
+	gl_Position = vec4(_PosOrTexCoord * 2.0f - 1.0f, 0.0f, 1.0f);
+}
\ No newline at end of file
@@ -1,35 +1,44 @@
 #version 310 es
 
 precision mediump float;
+precision highp int;
 precision mediump sampler2DArray;
 
 uniform sampler2DArray uTexArraySampler;
+uniform int uTexelShift; //  ػ ؽó   1Դϴ.
+uniform vec4 uTint; // Ƽ Դϴ.
 
-in vec2 TexCoord;
-in flat float TextureWidth;
+in highp vec2 TexCoord;
+in flat ivec3 TextureAddress; // start x, start band, width
+in flat mediump vec4 InstanceTint; // νϽ Դϴ. Ƽ  Բ ϴ.
+in flat highp vec4 TexCoordBounds; // low end, high start
+in flat highp vec4 TexCoordTransform; // high offset, center scale
+in highp vec2 ClipPosition;
+in flat highp vec4 ClipBounds; // ȸ Ʈ Ŭ 簢Դϴ. ȸ  Ʈ  ̴ ̹ ߶ϴ.
 
 out vec4 _Color;
 
 void main()
 {
-	vec3 atlasOffset = vec3(TexCoord, 0.0f);
+	// Ʈ ǥ  ̽   ؽó ǥ ٲߴϴ.  ׵θ ״,  ׵θ ű,  øϴ.
+	highp vec2 centerTexCoord = TexCoordBounds.xy + (TexCoord - TexCoordBounds.xy) * TexCoordTransform.zw;
+	highp vec2 texCoord = mix(mix(centerTexCoord, TexCoord, lessThan(TexCoord, TexCoordBounds.xy)), TexCoord + TexCoordTransform.xy, greaterThanEqual(TexCoord, TexCoordBounds.zw));
+	ivec2 texel = ivec2(texCoord);
 
-	float overTexCoordY = floor(TexCoord.y / 4.0f);
-	atlasOffset.x += overTexCoordY * TextureWidth;
-	atlasOffset.y -= overTexCoordY * 4.0f;
+	// ؽó 4ٸ    ũ⸸ŭ ڿ ֽϴ.
+	int x = TextureAddress.x + (texel.y >> 2) * TextureAddress.z + texel.x;
 
-	float overOffsetX = floor(atlasOffset.x / 512.0f);
-	atlasOffset.x -= overOffsetX * 512.0f;
-	atlasOffset.y += overOffsetX * 4.0f;
+	// 512  ŭ   Ѿ,  ȣ  Ʈ  ȣԴϴ.
+	int band = TextureAddress.y + (x >> 9);
+	ivec3 atlasTexel = ivec3(x & 511, ((band & 127) << 2) | (texel.y & 3), band >> 7);
 
-	float overOffsetY = floor(atlasOffset.y / 512.0f);
-	atlasOffset.y -= overOffsetY * 512.0f;
-	atlasOffset.z += overOffsetY;
+	_Color = texelFetch(uTexArraySampler, ivec3(atlasTexel.xy >> uTexelShift, atlasTexel.z), 0) * uTint * InstanceTint;
 
-	_Color = texture(uTexArraySampler, vec3(atlasOffset.xy / 512.0f, atlasOffset.z));
-
-	if (_Color.a < 0.05f)
+	//  Ʈ ̴ discard  early-Z  ʰ մϴ. ȸϰ ߸ Ʈ  н  ʽϴ.
+#ifndef OPAQUE
+	if (_Color.a < 0.05f || any(lessThan(ClipPosition, ClipBounds.xy)) || any(greaterThanEqual(ClipPosition, ClipBounds.zw)))
 	{
 		discard;
 	}
+#endif
 }
\ No newline at end of file
@@ -0,0 +1,15 @@
+#version 310 es
+
+precision mediump float;
+
+uniform vec4 uTint; // Ƽ Դϴ.
+
+in flat vec3 PointColor; // ؽó   νϽ   Դϴ.
+
+out vec4 _Color;
+
+void main()
+{
+	// ؽó  ʽϴ.    ũ⿡ ݿǷ ϰ ϴ.
+	_Color = vec4(PointColor, 1.0f) * uTint;
+}
\ No newline at end of file
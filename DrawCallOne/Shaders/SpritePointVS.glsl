@@ -0,0 +1,36 @@
+#version 310 es
+
+layout (location = 1) in mat4 _ProjectionViewWorld;
+layout (location = 5) in uvec4 _TextureAttribute; // width, height, start x, start band
+layout (location = 6) in uvec4 _SpriteStyle; // SpriteVS.glsl ϴ. tint ؽó    ְ Ĵ  Դϴ.
+
+uniform vec2 uViewportSize;
+
+out flat mediump vec3 PointColor;
+
+const float ROTATION_SCALE = 6.28318530718f / 65536.0f;
+const float PIVOT_SCALE = 1.0f / 32768.0f;
+
+void main()
+{
+	// SpriteVS.glsl  ǹ ȸ  簢   ϴ.
+	vec2 textureSize = vec2(_TextureAttribute.xy);
+	uvec2 styleSize = uvec2(_SpriteStyle.w & 0xFFFFu, _SpriteStyle.w >> 16u);
+	vec2 size = max(mix(vec2(styleSize), textureSize, equal(styleSize, uvec2(0u))), vec2(1.0f));
+	vec2 pivot = vec2(_SpriteStyle.y & 0xFFFFu, _SpriteStyle.y >> 16u) * PIVOT_SCALE;
+	float angle = float(_SpriteStyle.x & 0xFFFFu) * ROTATION_SCALE;
+	float cosine = cos(angle);
+	float sine = sin(angle);
+
+	vec2 offset = (vec2(0.5f) - pivot) * size;
+	vec2 localPosition = vec2(cosine * offset.x - sine * offset.y, sine * offset.x + cosine * offset.y) / size;
+
+	gl_Position = _ProjectionViewWorld * vec4(localPosition, 0.0f, 1.0f);
+
+	// 簢 ȼ ̿     簢 ׸ϴ.  Ʈ  Ǿ ȭ鿡 ϴ  մϴ.
+	vec4 color = unpackUnorm4x8(_SpriteStyle.z);
+	float area = abs(_ProjectionViewWorld[0].x * _ProjectionViewWorld[1].y - _ProjectionViewWorld[1].x * _ProjectionViewWorld[0].y) * uViewportSize.x * uViewportSize.y * 0.25f;
+
+	gl_PointSize = max(sqrt(area * color.a), 1.0f);
+	PointColor = color.rgb;
+}
\ No newline at end of file
@@ -2,20 +2,97 @@
 
 layout (location = 0) in vec2 _PosOrTexCoord;
 layout (location = 1) in mat4 _ProjectionViewWorld;
-layout (location = 5) in vec3 _TextureAttribute; // width, height, offset x
+layout (location = 5) in uvec4 _TextureAttribute; // width, height, start x, start band
+layout (location = 6) in uvec4 _SpriteStyle; // rotation | flip x, y | border | clip rect, pivot x | pivot y, tint, width | height (SpriteStyle.h)
 
-out vec2 TexCoord;
-out flat float TextureWidth;
+// Ŭ 簢 ǥԴϴ. ȭ ġ ǥ min x, min y, max x, max y̸ 0  ʽϴ.
+layout (std140, binding = 0) uniform ClipRectBlock
+{
+	vec4 uClipRects[256];
+};
+
+//  ̽ ׵θ ǥԴϴ. ؼ  , Ʒ, ,  β̸ 0  ʽϴ.
+layout (std140, binding = 1) uniform NineSliceBorderBlock
+{
+	vec4 uNineSliceBorders[64];
+};
+
+out highp vec2 TexCoord;
+out flat ivec3 TextureAddress; // start x, start band, width
+out flat mediump vec4 InstanceTint;
+out flat highp vec4 TexCoordBounds; // ؽó ǥ  ٲٴ Դϴ. low end, high start (SpriteStyle.h)
+out flat highp vec4 TexCoordTransform; // high offset, center scale
+out highp vec2 ClipPosition; // ȭ ġ ǥԴϴ.
+out flat highp vec4 ClipBounds; // ׸Ʈ ̴   ϴ. ڸ  ȭ麸 нϴ.
+
+const float ROTATION_SCALE = 6.28318530718f / 65536.0f;
+const float PIVOT_SCALE = 1.0f / 32768.0f;
 
 void main()
 {
-	gl_Position = _ProjectionViewWorld * vec4(_PosOrTexCoord, 0.0f, 1.0f);
+	// ũ⸦    ؽó ũ ׸ϴ. ProjectionViewWorld  ũ þ ֽϴ.
+	vec2 textureSize = vec2(_TextureAttribute.xy);
+	uvec2 styleSize = uvec2(_SpriteStyle.w & 0xFFFFu, _SpriteStyle.w >> 16u);
+	vec2 spriteSize = mix(vec2(styleSize), textureSize, equal(styleSize, uvec2(0u)));
+
+	// ǹ  Ű ȼ  ȸ  ٽ 0~1  ǥ ǵϴ.
+	vec2 size = max(spriteSize, vec2(1.0f));
+	vec2 pivot = vec2(_SpriteStyle.y & 0xFFFFu, _SpriteStyle.y >> 16u) * PIVOT_SCALE;
+	float angle = float(_SpriteStyle.x & 0xFFFFu) * ROTATION_SCALE;
+	float cosine = cos(angle);
+	float sine = sin(angle);
+
+	vec2 offset = (_PosOrTexCoord - pivot) * size;
+	vec2 localPosition = vec2(cosine * offset.x - sine * offset.y, sine * offset.x + cosine * offset.y) / size;
+
+	gl_Position = _ProjectionViewWorld * vec4(localPosition, 0.0f, 1.0f);
+
+	vec2 texCoord = _PosOrTexCoord;
+	uint clipRect = _SpriteStyle.x >> 24u;
+	ClipBounds = vec4(-2.0f, -2.0f, 2.0f, 2.0f);
+
+	if (clipRect != 0u)
+	{
+		vec4 bounds = uClipRects[clipRect];
+
+		if ((_SpriteStyle.x & 0xFFFFu) == 0u)
+		{
+			// ȸ  簢  簢  ű ؽó ǥ ű ŭ ̹Ƿ  ׸Ʈ ϴ.
+			//  ̹Ƿ ProjectionViewWorld 밢   ǥ 1ŭ ȭ Դϴ.
+			vec2 clampedPosition = clamp(gl_Position.xy, bounds.xy, bounds.zw);
+			texCoord += (clampedPosition - gl_Position.xy) / vec2(_ProjectionViewWorld[0].x, _ProjectionViewWorld[1].y);
+			gl_Position.xy = clampedPosition;
+		}
+		else
+		{
+			ClipBounds = bounds;
+		}
+	}
+
+	ClipPosition = gl_Position.xy;
+
+	//  ؽó Ƿ Ʈ ϴ ڸ ״Դϴ.
+	bvec2 flip = bvec2(_SpriteStyle.x & 0x10000u, _SpriteStyle.x & 0x20000u);
+	TexCoord.xy = mix(texCoord, 1.0f - texCoord, flip) * spriteSize;
+
+	// Ʈ ǥ ؽó ǥ ٲٴ  մϴ. ׵θ ؼ ũ ״,  þϴ.
+	// ׵θ  ü ̹Ƿ ũ⸦ ٲ Ʈ ؽó þ, ٲ ʾ ״Դϴ.
+	uint border = (_SpriteStyle.x >> 18u) & 0x3Fu;
+	vec4 borderSize = border != 0u ? uNineSliceBorders[border] : vec4(0.0f);
+
+	//  ׵θ ؽó ũ    Ǿ Ʈ  ؼ Ƿ ؽó °   Դϴ.
+	borderSize *= min(vec2(1.0f), textureSize / max(borderSize.xy + borderSize.zw, vec2(1.0f))).xyxy;
+	vec2 shrink = min(vec2(1.0f), spriteSize / max(borderSize.xy + borderSize.zw, vec2(1.0f)));
+	vec2 lowEnd = borderSize.xy * shrink;
+	vec2 highStart = mix(spriteSize - borderSize.zw, lowEnd, lessThan(shrink, vec2(1.0f)));
+	vec2 center = highStart - lowEnd;
+
+	TexCoordBounds = vec4(lowEnd, highStart);
+	TexCoordTransform.xy = textureSize - spriteSize;
+	TexCoordTransform.zw = mix(vec2(0.0f), (textureSize - borderSize.xy - borderSize.zw) / max(center, vec2(1e-6f)), greaterThan(center, vec2(0.0f)));
 
-	TexCoord.xy = _PosOrTexCoord * _TextureAttribute.xy;
-	
-	// ׸Ʈ ̴  ؽó  x մϴ.
-	TexCoord.x += _TextureAttribute.z;
+	// ׸Ʈ ̴   ġ ϰ ؽó  ũ⸦ 4  մϴ.
+	TextureAddress = ivec3(_TextureAttribute.zw, (_TextureAttribute.x + 3u) & ~3u);
 
-	// ؽó  ũ⸦ 4  մϴ.
-	TextureWidth = ceil(_TextureAttribute.x / 4.0f) * 4.0f;
+	InstanceTint = unpackUnorm4x8(_SpriteStyle.z);
 }
\ No newline at end of file
@@ -0,0 +1,1050 @@
+#include "AstcDecoder.h"
+
+#include <cassert>
+#include <cstring>
+#include <algorithm>
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__SSE2__)
+	#include <emmintrin.h>
+	#define ASTC_USE_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+	#include <arm_neon.h>
+	#define ASTC_USE_NEON
+#endif
+
+/*
+	ASTC  Ʒ  ϼ
+	https://registry.khronos.org/DataFormat/specs/1.3/dataformat.1.3.html#ASTC
+	Լ ̸   ڵ (  -> Ƽ ->  Ʈ -> ġ -> ) ״ ϴ.
+*/
+
+/*** Structures ***/
+struct IseQuantMode
+{
+	int Trits;
+	int Quints;
+	int Bits;
+};
+
+/*** Constant Variables ***/
+static constexpr int BLOCK_MAX_WEIGHT_COUNT = 64;
+static constexpr int BLOCK_MIN_WEIGHT_BITS = 24;
+static constexpr int BLOCK_MAX_WEIGHT_BITS = 96;
+static constexpr int BLOCK_MAX_COLOR_VALUE_COUNT = 18;
+static constexpr int QUANT_6 = 4; //  Ʈ Ǵ   ȭ ܰԴϴ.
+
+// ȭ ܰ躰 ISE Դϴ. 2, 3, 4, 5, 6, 8, 10, 12, 16, 20, 24, 32, 40, 48, 64, 80, 96, 128, 160, 192, 256 ܰ Դϴ.
+static constexpr IseQuantMode ISE_QUANT_MODES[] =
+{
+	{ 0, 0, 1 }, { 1, 0, 0 }, { 0, 0, 2 }, { 0, 1, 0 }, { 1, 0, 1 }, { 0, 0, 3 }, { 0, 1, 1 }
+	, { 1, 0, 2 }, { 0, 0, 4 }, { 0, 1, 2 }, { 1, 0, 3 }, { 0, 0, 5 }, { 0, 1, 3 }, { 1, 0, 4 }
+	, { 0, 0, 6 }, { 0, 1, 4 }, { 1, 0, 5 }, { 0, 0, 7 }, { 0, 1, 5 }, { 1, 0, 6 }, { 0, 0, 8 }
+};
+
+static constexpr int ISE_QUANT_MODE_COUNT = sizeof(ISE_QUANT_MODES) / sizeof(ISE_QUANT_MODES[0]);
+
+static constexpr uint8_t ERROR_COLOR[4] = { 255, 0, 255, 255 };
+
+/*** Global Functions ***/
+static uint32_t ReadBits(const uint8_t* data, int bitOffset, int bitCount, int bitEnd = 128);
+static int GetIseBitCount(int valueCount, int quantMode);
+static void DecodeIse(const uint8_t* data, int bitOffset, int bitCount, int quantMode, int valueCount, int* outValues);
+static int UnquantizeColor(int quantMode, int value);
+static int UnquantizeWeight(int quantMode, int value);
+static int Replicate(int value, int fromBitCount, int toBitCount);
+
+static bool DecodeBlockMode(uint32_t blockMode, int* weightWidth, int* weightHeight, bool* bDualPlane, int* weightQuantMode);
+static int SelectPartition(int seed, int x, int y, int z, int partitionCount, bool bSmallBlock);
+static bool DecodeColorEndpoints(int colorEndpointMode, const int* values, int* endpoint0, int* endpoint1);
+static void InterpolateTexel(const int32_t* endpoint0, const int32_t* endpoint1, const int32_t* weights, uint8_t* outTexel);
+static void FillErrorColor(int texelCount, uint8_t* outTexels);
+
+bool DecodeAstcBlock(const uint8_t* blockData, int blockWidth, int blockHeight, uint8_t* outTexels)
+{
+	assert(blockData != nullptr && outTexels != nullptr);
+	assert(blockWidth * blockHeight <= static_cast<int>(ASTC_MAX_BLOCK_TEXEL_COUNT));
+
+	const int texelCount = blockWidth * blockHeight;
+	const uint32_t blockMode = ReadBits(blockData, 0, 11);
+
+	// ̵ ͽƮ   ü   Դϴ.
+	if ((blockMode & 0x1FF) == 0x1FC)
+	{
+		// HDR ̵ ͽƮ LDR Ͽ  óմϴ.
+		if ((blockMode & 0x200) != 0)
+		{
+			FillErrorColor(texelCount, outTexels);
+			return false;
+		}
+
+		uint8_t color[4];
+
+		for (int i = 0; i < 4; ++i)
+		{
+			color[i] = static_cast<uint8_t>(ReadBits(blockData, 64 + i * 16, 16) >> 8);
+		}
+
+		for (int i = 0; i < texelCount; ++i)
+		{
+			memcpy(outTexels + i * 4, color, sizeof(color));
+		}
+
+		return true;
+	}
+
+	int weightWidth = 0;
+	int weightHeight = 0;
+	bool bDualPlane = false;
+	int weightQuantMode = 0;
+
+	if (DecodeBlockMode(blockMode, &weightWidth, &weightHeight, &bDualPlane, &weightQuantMode) == false
+		|| weightWidth > blockWidth || weightHeight > blockHeight)
+	{
+		FillErrorColor(texelCount, outTexels);
+		return false;
+	}
+
+	const int partitionCount = static_cast<int>(ReadBits(blockData, 11, 2)) + 1;
+	const int planeCount = bDualPlane ? 2 : 1;
+	const int weightCount = weightWidth * weightHeight * planeCount;
+	const int weightBitCount = GetIseBitCount(weightCount, weightQuantMode);
+
+	if ((bDualPlane && partitionCount == 4)
+		|| weightCount > BLOCK_MAX_WEIGHT_COUNT
+		|| weightBitCount < BLOCK_MIN_WEIGHT_BITS
+		|| weightBitCount > BLOCK_MAX_WEIGHT_BITS)
+	{
+		FillErrorColor(texelCount, outTexels);
+		return false;
+	}
+
+	// Ƽǰ  Ʈ 带 нϴ.
+	// ߰  Ʈ  ÷ ä  Ʈ ġ ٷ Ʒ ʴ  ֽϴ.
+	int belowWeightBitOffset = 128 - weightBitCount;
+	int partitionIndex = 0;
+	int colorBitOffset = 0;
+	int colorEndpointModes[4] = {};
+
+	if (partitionCount == 1)
+	{
+		colorEndpointModes[0] = static_cast<int>(ReadBits(blockData, 13, 4));
+		colorBitOffset = 17;
+	}
+	else
+	{
+		partitionIndex = static_cast<int>(ReadBits(blockData, 13, 10));
+		uint32_t encodedModes = ReadBits(blockData, 23, 6);
+		colorBitOffset = 29;
+
+		if ((encodedModes & 3) == 0)
+		{
+			for (int i = 0; i < partitionCount; ++i)
+			{
+				colorEndpointModes[i] = static_cast<int>(encodedModes >> 2);
+			}
+		}
+		else
+		{
+			const int extraBitCount = 3 * partitionCount - 4;
+			belowWeightBitOffset -= extraBitCount;
+			encodedModes |= ReadBits(blockData, belowWeightBitOffset, extraBitCount) << 6;
+
+			const int baseClass = static_cast<int>(encodedModes & 3) - 1;
+			encodedModes >>= 2;
+
+			int classOffsets[4] = {};
+
+			for (int i = 0; i < partitionCount; ++i)
+			{
+				classOffsets[i] = encodedModes & 1;
+				encodedModes >>= 1;
+			}
+
+			for (int i = 0; i < partitionCount; ++i)
+			{
+				colorEndpointModes[i] = ((baseClass + classOffsets[i]) << 2) | (encodedModes & 3);
+				encodedModes >>= 2;
+			}
+		}
+	}
+
+	int dualPlaneComponent = -1;
+
+	if (bDualPlane)
+	{
+		belowWeightBitOffset -= 2;
+		dualPlaneComponent = static_cast<int>(ReadBits(blockData, belowWeightBitOffset, 2));
+	}
+
+	//     Ʈ   Ʈ ȭ ܰ踦 մϴ.
+	int colorValueCount = 0;
+
+	for (int i = 0; i < partitionCount; ++i)
+	{
+		colorValueCount += ((colorEndpointModes[i] >> 2) + 1) * 2;
+	}
+
+	const int colorBitCount = belowWeightBitOffset - colorBitOffset;
+	int colorQuantMode = ISE_QUANT_MODE_COUNT - 1;
+
+	while (colorQuantMode >= 0 && GetIseBitCount(colorValueCount, colorQuantMode) > colorBitCount)
+	{
+		--colorQuantMode;
+	}
+
+	if (colorValueCount > BLOCK_MAX_COLOR_VALUE_COUNT || colorQuantMode < QUANT_6)
+	{
+		FillErrorColor(texelCount, outTexels);
+		return false;
+	}
+
+	int colorValues[BLOCK_MAX_COLOR_VALUE_COUNT];
+	DecodeIse(blockData, colorBitOffset, colorBitCount, colorQuantMode, colorValueCount, colorValues);
+
+	for (int i = 0; i < colorValueCount; ++i)
+	{
+		colorValues[i] = UnquantizeColor(colorQuantMode, colorValues[i]);
+	}
+
+	// Ʈ 16Ʈ Ȯ Ӵϴ. (e << 8 | e)
+	int32_t endpoints[4][2][4];
+	const int* partitionColorValues = colorValues;
+
+	for (int i = 0; i < partitionCount; ++i)
+	{
+		int endpoint0[4];
+		int endpoint1[4];
+
+		if (DecodeColorEndpoints(colorEndpointModes[i], partitionColorValues, endpoint0, endpoint1) == false)
+		{
+			FillErrorColor(texelCount, outTexels);
+			return false;
+		}
+
+		for (int j = 0; j < 4; ++j)
+		{
+			endpoints[i][0][j] = endpoint0[j] * 257;
+			endpoints[i][1][j] = endpoint1[j] * 257;
+		}
+
+		partitionColorValues += ((colorEndpointModes[i] >> 2) + 1) * 2;
+	}
+
+	// ġ    Ʈ Ųٷ Ǿ Ƿ    нϴ.
+	uint8_t reversedBlock[16];
+
+	for (int i = 0; i < 16; ++i)
+	{
+		uint8_t value = blockData[15 - i];
+		value = static_cast<uint8_t>(((value & 0xF0) >> 4) | ((value & 0x0F) << 4));
+		value = static_cast<uint8_t>(((value & 0xCC) >> 2) | ((value & 0x33) << 2));
+		value = static_cast<uint8_t>(((value & 0xAA) >> 1) | ((value & 0x55) << 1));
+		reversedBlock[i] = value;
+	}
+
+	//  ڸ ٱ ġ о ϵ   Ӵϴ. ̶   0Դϴ.
+	int weights[BLOCK_MAX_WEIGHT_COUNT + 32] = {};
+	DecodeIse(reversedBlock, 0, weightBitCount, weightQuantMode, weightCount, weights);
+
+	for (int i = 0; i < weightCount; ++i)
+	{
+		weights[i] = UnquantizeWeight(weightQuantMode, weights[i]);
+	}
+
+	// ġ ڸ  ؼ ũ   ϸ鼭 ؼ  մϴ.
+	const int scaleX = (1024 + blockWidth / 2) / (blockWidth - 1);
+	const int scaleY = (1024 + blockHeight / 2) / (blockHeight - 1);
+	const bool bSmallBlock = texelCount < 31;
+
+	for (int y = 0; y < blockHeight; ++y)
+	{
+		for (int x = 0; x < blockWidth; ++x)
+		{
+			const int gridX = (scaleX * x * (weightWidth - 1) + 32) >> 6;
+			const int gridY = (scaleY * y * (weightHeight - 1) + 32) >> 6;
+			const int fractionX = gridX & 0xF;
+			const int fractionY = gridY & 0xF;
+			const int weightIndex = (gridX >> 4) + (gridY >> 4) * weightWidth;
+
+			const int factor11 = (fractionX * fractionY + 8) >> 4;
+			const int factor10 = fractionY - factor11;
+			const int factor01 = fractionX - factor11;
+			const int factor00 = 16 - fractionX - fractionY + factor11;
+
+			int32_t planeWeights[2];
+
+			for (int plane = 0; plane < planeCount; ++plane)
+			{
+				const int* planeWeight = weights + plane;
+
+				planeWeights[plane] = (planeWeight[weightIndex * planeCount] * factor00
+					+ planeWeight[(weightIndex + 1) * planeCount] * factor01
+					+ planeWeight[(weightIndex + weightWidth) * planeCount] * factor10
+					+ planeWeight[(weightIndex + weightWidth + 1) * planeCount] * factor11
+					+ 8) >> 4;
+			}
+
+			int32_t texelWeights[4] = { planeWeights[0], planeWeights[0], planeWeights[0], planeWeights[0] };
+
+			if (bDualPlane)
+			{
+				texelWeights[dualPlaneComponent] = planeWeights[1];
+			}
+
+			const int partition = partitionCount > 1 ? SelectPartition(partitionIndex, x, y, 0, partitionCount, bSmallBlock) : 0;
+
+			InterpolateTexel(endpoints[partition][0], endpoints[partition][1], texelWeights, outTexels + (y * blockWidth + x) * 4);
+		}
+	}
+
+	return true;
+}
+
+void DecodeAstcImage(const uint8_t* data, int blockWidth, int blockHeight, uint32_t width, uint32_t height, uint8_t* outPixels)
+{
+	assert(data != nullptr && outPixels != nullptr);
+
+	const uint32_t xBlocks = (width + blockWidth - 1) / blockWidth;
+	const uint32_t yBlocks = (height + blockHeight - 1) / blockHeight;
+
+	uint8_t texels[ASTC_MAX_BLOCK_TEXEL_COUNT * 4];
+
+	for (uint32_t blockY = 0; blockY < yBlocks; ++blockY)
+	{
+		for (uint32_t blockX = 0; blockX < xBlocks; ++blockX)
+		{
+			DecodeAstcBlock(data + (blockY * xBlocks + blockX) * 16, blockWidth, blockHeight, texels);
+
+			// ̹ ũⰡ  ũ  ƴϸ ڸ  ٱ ؼ ϴ.
+			const uint32_t copyWidth = std::min<uint32_t>(blockWidth, width - blockX * blockWidth);
+			const uint32_t copyHeight = std::min<uint32_t>(blockHeight, height - blockY * blockHeight);
+
+			for (uint32_t y = 0; y < copyHeight; ++y)
+			{
+				memcpy(outPixels + ((blockY * blockHeight + y) * width + blockX * blockWidth) * 4
+					, texels + y * blockWidth * 4
+					, copyWidth * 4);
+			}
+		}
+	}
+}
+
+void InitializeAstcBlockCache(AstcBlockCache* cache, int blockWidth, int blockHeight, size_t capacity)
+{
+	assert(cache != nullptr && "the cache must not be null");
+	assert(blockWidth * blockHeight <= static_cast<int>(ASTC_MAX_BLOCK_TEXEL_COUNT));
+
+	cache->BlockWidth = blockWidth;
+	cache->BlockHeight = blockHeight;
+	cache->Capacity = std::max<size_t>(capacity, 1);
+	cache->HitCount = 0;
+	cache->MissCount = 0;
+	cache->Blocks.clear();
+	cache->BlockIndices.clear();
+	cache->BlockIndices.reserve(cache->Capacity);
+}
+
+const uint8_t* DecodeAstcBlockCached(AstcBlockCache* cache, const uint8_t* blockData)
+{
+	assert(cache != nullptr && blockData != nullptr);
+
+	AstcBlockKey key;
+	memcpy(&key.Low, blockData, sizeof(key.Low));
+	memcpy(&key.High, blockData + sizeof(key.Low), sizeof(key.High));
+
+	const auto& foundBlock = cache->BlockIndices.find(key);
+
+	if (foundBlock != cache->BlockIndices.end())
+	{
+		++cache->HitCount;
+
+		//  ֱٿ   űϴ.
+		cache->Blocks.splice(cache->Blocks.begin(), cache->Blocks, foundBlock->second);
+		return foundBlock->second->Texels;
+	}
+
+	++cache->MissCount;
+
+	//  á     ڸ մϴ.
+	if (cache->Blocks.size() >= cache->Capacity)
+	{
+		cache->BlockIndices.erase(cache->Blocks.back().Key);
+		cache->Blocks.splice(cache->Blocks.begin(), cache->Blocks, std::prev(cache->Blocks.end()));
+	}
+	else
+	{
+		cache->Blocks.emplace_front();
+	}
+
+	AstcCachedBlock& cachedBlock = cache->Blocks.front();
+	cachedBlock.Key = key;
+	DecodeAstcBlock(blockData, cache->BlockWidth, cache->BlockHeight, cachedBlock.Texels);
+
+	cache->BlockIndices.insert(std::make_pair(key, cache->Blocks.begin()));
+
+	return cachedBlock.Texels;
+}
+
+uint32_t ReadBits(const uint8_t* data, int bitOffset, int bitCount, int bitEnd)
+{
+	// bitEnd Ѿ Ʈ 0 нϴ. ISE    ߷   ʿմϴ.
+	uint32_t result = 0;
+
+	for (int i = 0; i < bitCount; ++i)
+	{
+		const int bit = bitOffset + i;
+
+		if (bit >= bitEnd)
+		{
+			break;
+		}
+
+		result |= ((data[bit >> 3] >> (bit & 7)) & 1u) << i;
+	}
+
+	return result;
+}
+
+int GetIseBitCount(int valueCount, int quantMode)
+{
+	const IseQuantMode& mode = ISE_QUANT_MODES[quantMode];
+
+	return valueCount * mode.Bits
+		+ (mode.Trits != 0 ? (valueCount * 8 + 4) / 5 : 0)
+		+ (mode.Quints != 0 ? (valueCount * 7 + 2) / 3 : 0);
+}
+
+void DecodeIse(const uint8_t* data, int bitOffset, int bitCount, int quantMode, int valueCount, int* outValues)
+{
+	/*
+		  (Ʈ Ǵ Ʈ  << Ʈ ) | Ʈ  · ˴ϴ.
+		ȭ   κ  ϱ Դϴ.
+	*/
+	const IseQuantMode& mode = ISE_QUANT_MODES[quantMode];
+	const int bitEnd = bitOffset + bitCount;
+	const int bits = mode.Bits;
+
+	int position = bitOffset;
+
+	if (mode.Trits != 0)
+	{
+		// Ʈ 5 8Ʈ T    Ʈ ̻̿ 2, 2, 1, 2, 1 Ʈ  ֽϴ.
+		static constexpr int TRIT_BIT_COUNTS[5] = { 2, 2, 1, 2, 1 };
+
+		for (int i = 0; i < valueCount; i += 5)
+		{
+			int values[5];
+			uint32_t packed = 0;
+			int packedShift = 0;
+
+			for (int j = 0; j < 5; ++j)
+			{
+				values[j] = static_cast<int>(ReadBits(data, position, bits, bitEnd));
+				position += bits;
+
+				packed |= ReadBits(data, position, TRIT_BIT_COUNTS[j], bitEnd) << packedShift;
+				position += TRIT_BIT_COUNTS[j];
+				packedShift += TRIT_BIT_COUNTS[j];
+			}
+
+			int trits[5];
+			uint32_t c = 0;
+
+			if (((packed >> 2) & 7) == 7)
+			{
+				c = ((packed >> 5) << 2) | (packed & 3);
+				trits[4] = 2;
+				trits[3] = 2;
+			}
+			else
+			{
+				c = packed & 0x1F;
+
+				if (((packed >> 5) & 3) == 3)
+				{
+					trits[4] = 2;
+					trits[3] = (packed >> 7) & 1;
+				}
+				else
+				{
+					trits[4] = (packed >> 7) & 1;
+					trits[3] = (packed >> 5) & 3;
+				}
+			}
+
+			if ((c & 3) == 3)
+			{
+				trits[2] = 2;
+				trits[1] = (c >> 4) & 1;
+				trits[0] = (((c >> 3) & 1) << 1) | (((c >> 2) & 1) & ~((c >> 3) & 1));
+			}
+			else if (((c >> 2) & 3) == 3)
+			{
+				trits[2] = 2;
+				trits[1] = 2;
+				trits[0] = c & 3;
+			}
+			else
+			{
+				trits[2] = (c >> 4) & 1;
+				trits[1] = (c >> 2) & 3;
+				trits[0] = (((c >> 1) & 1) << 1) | ((c & 1) & ~((c >> 1) & 1));
+			}
+
+			for (int j = 0; j < 5 && i + j < valueCount; ++j)
+			{
+				outValues[i + j] = (trits[j] << bits) | values[j];
+			}
+		}
+	}
+	else if (mode.Quints != 0)
+	{
+		// Ʈ 3 7Ʈ Q    Ʈ ڿ 3, 2, 2 Ʈ  ֽϴ.
+		static constexpr int QUINT_BIT_COUNTS[3] = { 3, 2, 2 };
+
+		for (int i = 0; i < valueCount; i += 3)
+		{
+			int values[3];
+			uint32_t packed = 0;
+			int packedShift = 0;
+
+			for (int j = 0; j < 3; ++j)
+			{
+				values[j] = static_cast<int>(ReadBits(data, position, bits, bitEnd));
+				position += bits;
+
+				packed |= ReadBits(data, position, QUINT_BIT_COUNTS[j], bitEnd) << packedShift;
+				position += QUINT_BIT_COUNTS[j];
+				packedShift += QUINT_BIT_COUNTS[j];
+			}
+
+			int quints[3];
+
+			if (((packed >> 1) & 3) == 3 && ((packed >> 5) & 3) == 0)
+			{
+				const uint32_t q0 = packed & 1;
+				quints[2] = static_cast<int>((q0 << 2) | ((((packed >> 4) & 1) & ~q0) << 1) | (((packed >> 3) & 1) & ~q0));
+				quints[1] = 4;
+				quints[0] = 4;
+			}
+			else
+			{
+				uint32_t c = 0;
+
+				if (((packed >> 1) & 3) == 3)
+				{
+					quints[2] = 4;
+					c = (((packed >> 3) & 3) << 3) | ((~(packed >> 5) & 3) << 1) | (packed & 1);
+				}
+				else
+				{
+					quints[2] = (packed >> 5) & 3;
+					c = packed & 0x1F;
+				}
+
+				if ((c & 7) == 5)
+				{
+					quints[1] = 4;
+					quints[0] = (c >> 3) & 3;
+				}
+				else
+				{
+					quints[1] = (c >> 3) & 3;
+					quints[0] = c & 7;
+				}
+			}
+
+			for (int j = 0; j < 3 && i + j < valueCount; ++j)
+			{
+				outValues[i + j] = (quints[j] << bits) | values[j];
+			}
+		}
+	}
+	else
+	{
+		for (int i = 0; i < valueCount; ++i)
+		{
+			outValues[i] = static_cast<int>(ReadBits(data, position, bits, bitEnd));
+			position += bits;
+		}
+	}
+}
+
+int UnquantizeColor(int quantMode, int value)
+{
+	//   0~255  ȭ˴ϴ.
+	const IseQuantMode& mode = ISE_QUANT_MODES[quantMode];
+	const int bits = mode.Bits;
+	const int m = value & ((1 << bits) - 1);
+
+	if (mode.Trits == 0 && mode.Quints == 0)
+	{
+		return Replicate(m, bits, 8);
+	}
+
+	const int d = value >> bits;
+	const int a = (m & 1) != 0 ? 0x1FF : 0;
+	const int b = (m >> 1) & 1;
+	const int c = (m >> 2) & 1;
+	const int e = (m >> 3) & 1;
+	const int f = (m >> 4) & 1;
+	const int g = (m >> 5) & 1;
+
+	int B = 0;
+	int C = 0;
+
+	if (mode.Trits != 0)
+	{
+		switch (bits)
+		{
+		case 1: C = 204; break;
+		case 2: C = 93; B = (b << 8) | (b << 4) | (b << 2) | (b << 1); break;
+		case 3: C = 44; B = (c << 8) | (b << 7) | (c << 3) | (b << 2) | (c << 1) | b; break;
+		case 4: C = 22; B = (e << 8) | (c << 7) | (b << 6) | (e << 2) | (c << 1) | b; break;
+		case 5: C = 11; B = (f << 8) | (e << 7) | (c << 6) | (b << 5) | (f << 1) | e; break;
+		case 6: C = 5; B = (g << 8) | (f << 7) | (e << 6) | (c << 5) | (b << 4) | g; break;
+		default: assert(false && "Invalid trit quant mode"); break;
+		}
+	}
+	else
+	{
+		switch (bits)
+		{
+		case 1: C = 113; break;
+		case 2: C = 54; B = (b << 8) | (b << 3) | (b << 2); break;
+		case 3: C = 26; B = (c << 8) | (b << 7) | (c << 2) | (b << 1) | c; break;
+		case 4: C = 13; B = (e << 8) | (c << 7) | (b << 6) | (e << 1) | c; break;
+		case 5: C = 6; B = (f << 8) | (e << 7) | (c << 6) | (b << 5) | f; break;
+		default: assert(false && "Invalid quint quant mode"); break;
+		}
+	}
+
+	int t = d * C + B;
+	t ^= a;
+
+	return (a & 0x80) | (t >> 2);
+}
+
+int UnquantizeWeight(int quantMode, int value)
+{
+	// ġ 0~64  ȭ˴ϴ.
+	const IseQuantMode& mode = ISE_QUANT_MODES[quantMode];
+	const int bits = mode.Bits;
+	const int m = value & ((1 << bits) - 1);
+	const int d = value >> bits;
+
+	int result = 0;
+
+	if (mode.Trits == 0 && mode.Quints == 0)
+	{
+		result = Replicate(m, bits, 6);
+	}
+	else if (bits == 0)
+	{
+		static constexpr int TRIT_WEIGHTS[3] = { 0, 32, 63 };
+		static constexpr int QUINT_WEIGHTS[5] = { 0, 16, 32, 47, 63 };
+
+		result = mode.Trits != 0 ? TRIT_WEIGHTS[d] : QUINT_WEIGHTS[d];
+	}
+	else
+	{
+		const int a = (m & 1) != 0 ? 0x7F : 0;
+		const int b = (m >> 1) & 1;
+		const int c = (m >> 2) & 1;
+
+		int B = 0;
+		int C = 0;
+
+		if (mode.Trits != 0)
+		{
+			switch (bits)
+			{
+			case 1: C = 50; break;
+			case 2: C = 23; B = (b << 6) | (b << 2) | b; break;
+			case 3: C = 11; B = (c << 6) | (b << 5) | (c << 1) | b; break;
+			default: assert(false && "Invalid trit quant mode"); break;
+			}
+		}
+		else
+		{
+			switch (bits)
+			{
+			case 1: C = 28; break;
+			case 2: C = 13; B = (b << 6) | (b << 1); break;
+			default: assert(false && "Invalid quint quant mode"); break;
+			}
+		}
+
+		int t = d * C + B;
+		t ^= a;
+
+		result = (a & 0x20) | (t >> 2);
+	}
+
+	return result > 32 ? result + 1 : result;
+}
+
+int Replicate(int value, int fromBitCount, int toBitCount)
+{
+	int result = 0;
+	int shift = toBitCount;
+
+	while (shift > 0)
+	{
+		shift -= fromBitCount;
+		result |= shift >= 0 ? value << shift : value >> -shift;
+	}
+
+	return result;
+}
+
+bool DecodeBlockMode(uint32_t blockMode, int* weightWidth, int* weightHeight, bool* bDualPlane, int* weightQuantMode)
+{
+	int quantRange = (blockMode >> 4) & 1;
+	int highPrecision = (blockMode >> 9) & 1;
+	int dualPlane = (blockMode >> 10) & 1;
+	const int a = (blockMode >> 5) & 3;
+
+	if ((blockMode & 3) != 0)
+	{
+		quantRange |= (blockMode & 3) << 1;
+		int b = (blockMode >> 7) & 3;
+
+		switch ((blockMode >> 2) & 3)
+		{
+		case 0: *weightWidth = b + 4; *weightHeight = a + 2; break;
+		case 1: *weightWidth = b + 8; *weightHeight = a + 2; break;
+		case 2: *weightWidth = a + 2; *weightHeight = b + 8; break;
+		default:
+			b &= 1;
+
+			if ((blockMode & 0x100) != 0)
+			{
+				*weightWidth = b + 2;
+				*weightHeight = a + 2;
+			}
+			else
+			{
+				*weightWidth = a + 2;
+				*weightHeight = b + 6;
+			}
+			break;
+		}
+	}
+	else
+	{
+		quantRange |= ((blockMode >> 2) & 3) << 1;
+
+		if (((blockMode >> 2) & 3) == 0)
+		{
+			return false;
+		}
+
+		const int b = (blockMode >> 9) & 3;
+
+		switch ((blockMode >> 7) & 3)
+		{
+		case 0: *weightWidth = 12; *weightHeight = a + 2; break;
+		case 1: *weightWidth = a + 2; *weightHeight = 12; break;
+		case 2:
+			*weightWidth = a + 6;
+			*weightHeight = b + 6;
+			dualPlane = 0;
+			highPrecision = 0;
+			break;
+		default:
+			switch (a)
+			{
+			case 0: *weightWidth = 6; *weightHeight = 10; break;
+			case 1: *weightWidth = 10; *weightHeight = 6; break;
+			default: return false;
+			}
+			break;
+		}
+	}
+
+	*bDualPlane = dualPlane != 0;
+	*weightQuantMode = quantRange - 2 + highPrecision * 6;
+
+	return true;
+}
+
+int SelectPartition(int seed, int x, int y, int z, int partitionCount, bool bSmallBlock)
+{
+	//  ǵ Ƽ ؽ ԼԴϴ. ڴ Ʈ  ƾ ϹǷ ״ Űϴ.
+	if (bSmallBlock)
+	{
+		x <<= 1;
+		y <<= 1;
+		z <<= 1;
+	}
+
+	seed += (partitionCount - 1) * 1024;
+
+	uint32_t random = static_cast<uint32_t>(seed);
+	random ^= random >> 15;
+	random *= 0xEEDE0891;
+	random ^= random >> 5;
+	random += random << 16;
+	random ^= random >> 7;
+	random ^= random >> 3;
+	random ^= random << 6;
+	random ^= random >> 17;
+
+	int seeds[12] =
+	{
+		static_cast<int>(random & 0xF), static_cast<int>((random >> 4) & 0xF)
+		, static_cast<int>((random >> 8) & 0xF), static_cast<int>((random >> 12) & 0xF)
+		, static_cast<int>((random >> 16) & 0xF), static_cast<int>((random >> 20) & 0xF)
+		, static_cast<int>((random >> 24) & 0xF), static_cast<int>((random >> 28) & 0xF)
+		, static_cast<int>((random >> 18) & 0xF), static_cast<int>((random >> 22) & 0xF)
+		, static_cast<int>((random >> 26) & 0xF), static_cast<int>(((random >> 30) | (random << 2)) & 0xF)
+	};
+
+	for (int& value : seeds)
+	{
+		value *= value;
+	}
+
+	int shift1 = 0;
+	int shift2 = 0;
+
+	if ((seed & 1) != 0)
+	{
+		shift1 = (seed & 2) != 0 ? 4 : 5;
+		shift2 = partitionCount == 3 ? 6 : 5;
+	}
+	else
+	{
+		shift1 = partitionCount == 3 ? 6 : 5;
+		shift2 = (seed & 2) != 0 ? 4 : 5;
+	}
+
+	const int shift3 = (seed & 0x10) != 0 ? shift1 : shift2;
+
+	for (int i = 0; i < 8; ++i)
+	{
+		seeds[i] >>= (i & 1) != 0 ? shift2 : shift1;
+	}
+
+	for (int i = 8; i < 12; ++i)
+	{
+		seeds[i] >>= shift3;
+	}
+
+	int a = (seeds[0] * x + seeds[1] * y + seeds[10] * z + static_cast<int>(random >> 14)) & 0x3F;
+	int b = (seeds[2] * x + seeds[3] * y + seeds[11] * z + static_cast<int>(random >> 10)) & 0x3F;
+	int c = (seeds[4] * x + seeds[5] * y + seeds[8] * z + static_cast<int>(random >> 6)) & 0x3F;
+	int d = (seeds[6] * x + seeds[7] * y + seeds[9] * z + static_cast<int>(random >> 2)) & 0x3F;
+
+	if (partitionCount <= 3)
+	{
+		d = 0;
+	}
+
+	if (partitionCount <= 2)
+	{
+		c = 0;
+	}
+
+	if (a >= b && a >= c && a >= d)
+	{
+		return 0;
+	}
+	else if (b >= c && b >= d)
+	{
+		return 1;
+	}
+	else if (c >= d)
+	{
+		return 2;
+	}
+
+	return 3;
+}
+
+static void TransferBitsSigned(int* a, int* b)
+{
+	*b = (*b >> 1) | (*a & 0x80);
+	*a = (*a >> 1) & 0x3F;
+
+	if ((*a & 0x20) != 0)
+	{
+		*a -= 0x40;
+	}
+}
+
+static void SetEndpoint(int* endpoint, int r, int g, int b, int a)
+{
+	endpoint[0] = std::min(std::max(r, 0), 255);
+	endpoint[1] = std::min(std::max(g, 0), 255);
+	endpoint[2] = std::min(std::max(b, 0), 255);
+	endpoint[3] = std::min(std::max(a, 0), 255);
+}
+
+static void SetBlueContractedEndpoint(int* endpoint, int r, int g, int b, int a)
+{
+	SetEndpoint(endpoint, (r + b) >> 1, (g + b) >> 1, b, a);
+}
+
+bool DecodeColorEndpoints(int colorEndpointMode, const int* values, int* endpoint0, int* endpoint1)
+{
+	int v[8];
+	memcpy(v, values, sizeof(int) * ((colorEndpointMode >> 2) + 1) * 2);
+
+	switch (colorEndpointMode)
+	{
+	case 0: // ֵ
+		SetEndpoint(endpoint0, v[0], v[0], v[0], 255);
+		SetEndpoint(endpoint1, v[1], v[1], v[1], 255);
+		break;
+
+	case 1: // ֵ,  + 
+	{
+		const int l0 = (v[0] >> 2) | (v[1] & 0xC0);
+		const int l1 = std::min(l0 + (v[1] & 0x3F), 255);
+
+		SetEndpoint(endpoint0, l0, l0, l0, 255);
+		SetEndpoint(endpoint1, l1, l1, l1, 255);
+		break;
+	}
+
+	case 4: // ֵ + 
+		SetEndpoint(endpoint0, v[0], v[0], v[0], v[2]);
+		SetEndpoint(endpoint1, v[1], v[1], v[1], v[3]);
+		break;
+
+	case 5: // ֵ + ,  + 
+		TransferBitsSigned(&v[1], &v[0]);
+		TransferBitsSigned(&v[3], &v[2]);
+
+		SetEndpoint(endpoint0, v[0], v[0], v[0], v[2]);
+		SetEndpoint(endpoint1, v[0] + v[1], v[0] + v[1], v[0] + v[1], v[2] + v[3]);
+		break;
+
+	case 6: // RGB,  * 
+		SetEndpoint(endpoint0, (v[0] * v[3]) >> 8, (v[1] * v[3]) >> 8, (v[2] * v[3]) >> 8, 255);
+		SetEndpoint(endpoint1, v[0], v[1], v[2], 255);
+		break;
+
+	case 8: // RGB
+		if (v[1] + v[3] + v[5] >= v[0] + v[2] + v[4])
+		{
+			SetEndpoint(endpoint0, v[0], v[2], v[4], 255);
+			SetEndpoint(endpoint1, v[1], v[3], v[5], 255);
+		}
+		else
+		{
+			SetBlueContractedEndpoint(endpoint0, v[1], v[3], v[5], 255);
+			SetBlueContractedEndpoint(endpoint1, v[0], v[2], v[4], 255);
+		}
+		break;
+
+	case 9: // RGB,  + 
+		TransferBitsSigned(&v[1], &v[0]);
+		TransferBitsSigned(&v[3], &v[2]);
+		TransferBitsSigned(&v[5], &v[4]);
+
+		if (v[1] + v[3] + v[5] >= 0)
+		{
+			SetEndpoint(endpoint0, v[0], v[2], v[4], 255);
+			SetEndpoint(endpoint1, v[0] + v[1], v[2] + v[3], v[4] + v[5], 255);
+		}
+		else
+		{
+			SetBlueContractedEndpoint(endpoint0, v[0] + v[1], v[2] + v[3], v[4] + v[5], 255);
+			SetBlueContractedEndpoint(endpoint1, v[0], v[2], v[4], 255);
+		}
+		break;
+
+	case 10: // RGB,  *  +   
+		SetEndpoint(endpoint0, (v[0] * v[3]) >> 8, (v[1] * v[3]) >> 8, (v[2] * v[3]) >> 8, v[4]);
+		SetEndpoint(endpoint1, v[0], v[1], v[2], v[5]);
+		break;
+
+	case 12: // RGBA
+		if (v[1] + v[3] + v[5] >= v[0] + v[2] + v[4])
+		{
+			SetEndpoint(endpoint0, v[0], v[2], v[4], v[6]);
+			SetEndpoint(endpoint1, v[1], v[3], v[5], v[7]);
+		}
+		else
+		{
+			SetBlueContractedEndpoint(endpoint0, v[1], v[3], v[5], v[7]);
+			SetBlueContractedEndpoint(endpoint1, v[0], v[2], v[4], v[6]);
+		}
+		break;
+
+	case 13: // RGBA,  + 
+		TransferBitsSigned(&v[1], &v[0]);
+		TransferBitsSigned(&v[3], &v[2]);
+		TransferBitsSigned(&v[5], &v[4]);
+		TransferBitsSigned(&v[7], &v[6]);
+
+		if (v[1] + v[3] + v[5] >= 0)
+		{
+			SetEndpoint(endpoint0, v[0], v[2], v[4], v[6]);
+			SetEndpoint(endpoint1, v[0] + v[1], v[2] + v[3], v[4] + v[5], v[6] + v[7]);
+		}
+		else
+		{
+			SetBlueContractedEndpoint(endpoint0, v[0] + v[1], v[2] + v[3], v[4] + v[5], v[6] + v[7]);
+			SetBlueContractedEndpoint(endpoint1, v[0], v[2], v[4], v[6]);
+		}
+		break;
+
+	default: // 2, 3, 7, 11, 14, 15  HDR Դϴ.
+		return false;
+	}
+
+	return true;
+}
+
+void InterpolateTexel(const int32_t* endpoint0, const int32_t* endpoint1, const int32_t* weights, uint8_t* outTexel)
+{
+	/*
+		C = (C0 * (64 - w) + C1 * w + 32) >> 6  ä 4 ÿ ϰ  8Ʈ ɴϴ.
+		߰  2^24 ۱  float ص    ϴ.
+		п SSE2  32Ʈ    float    ֽϴ.
+	*/
+#if defined(ASTC_USE_SSE2)
+	const __m128 color0 = _mm_cvtepi32_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(endpoint0)));
+	const __m128 color1 = _mm_cvtepi32_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(endpoint1)));
+	const __m128 weight = _mm_cvtepi32_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(weights)));
+
+	__m128 color = _mm_add_ps(_mm_mul_ps(color0, _mm_sub_ps(_mm_set1_ps(64.0f), weight)), _mm_mul_ps(color1, weight));
+	color = _mm_mul_ps(_mm_add_ps(color, _mm_set1_ps(32.0f)), _mm_set1_ps(1.0f / 16384.0f));
+
+	__m128i result = _mm_cvttps_epi32(color);
+	result = _mm_packs_epi32(result, result);
+	result = _mm_packus_epi16(result, result);
+
+	const int32_t texel = _mm_cvtsi128_si32(result);
+	memcpy(outTexel, &texel, sizeof(texel));
+#elif defined(ASTC_USE_NEON)
+	const float32x4_t color0 = vcvtq_f32_s32(vld1q_s32(endpoint0));
+	const float32x4_t color1 = vcvtq_f32_s32(vld1q_s32(endpoint1));
+	const float32x4_t weight = vcvtq_f32_s32(vld1q_s32(weights));
+
+	float32x4_t color = vmlaq_f32(vdupq_n_f32(32.0f), color0, vsubq_f32(vdupq_n_f32(64.0f), weight));
+	color = vmulq_n_f32(vmlaq_f32(color, color1, weight), 1.0f / 16384.0f);
+
+	const uint16x4_t result16 = vqmovun_s32(vcvtq_s32_f32(color));
+	const uint8x8_t result8 = vqmovn_u16(vcombine_u16(result16, result16));
+
+	vst1_lane_u32(reinterpret_cast<uint32_t*>(outTexel), vreinterpret_u32_u8(result8), 0);
+#else
+	for (int i = 0; i < 4; ++i)
+	{
+		outTexel[i] = static_cast<uint8_t>(((endpoint0[i] * (64 - weights[i]) + endpoint1[i] * weights[i] + 32) >> 6) >> 8);
+	}
+#endif
+}
+
+void FillErrorColor(int texelCount, uint8_t* outTexels)
+{
+	for (int i = 0; i < texelCount; ++i)
+	{
+		memcpy(outTexels + i * 4, ERROR_COLOR, sizeof(ERROR_COLOR));
+	}
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+/*
+	GPU  ASTC  RGBA8 Ǯִ Ʈ ڴԴϴ.
+	ASTC  ʴ  ü ,  , GPU  ȯ濡 ؼ ˻  մϴ.
+
+	LDR  2D   մϴ. (Ƽ,  ÷, ̵ ͽƮ  )
+	HDR ̳ ߸     (Ÿ) ڵ˴ϴ.
+*/
+
+#include <cstdint>
+#include <cstddef>
+#include <list>
+#include <unordered_map>
+
+static constexpr size_t ASTC_MAX_BLOCK_TEXEL_COUNT = 12 * 12;
+
+//  ϳ(16Ʈ) blockWidth x blockHeight ũ RGBA8 ؼ ڵմϴ. ؼ  켱 ˴ϴ.
+//  ̸ false ȯϸ ̶    äϴ.
+bool DecodeAstcBlock(const uint8_t* blockData, int blockWidth, int blockHeight, uint8_t* outTexels);
+
+//   ASTC ̹  ü width x height ũ RGBA8 ̹ ڵմϴ.
+void DecodeAstcImage(const uint8_t* data, int blockWidth, int blockHeight, uint32_t width, uint32_t height, uint8_t* outPixels);
+
+struct AstcBlockKey
+{
+	uint64_t Low;
+	uint64_t High;
+
+	bool operator==(const AstcBlockKey& other) const { return Low == other.Low && High == other.High; }
+};
+
+struct AstcBlockKeyHash
+{
+	size_t operator()(const AstcBlockKey& key) const { return static_cast<size_t>(key.Low * 0x9E3779B97F4A7C15ull ^ key.High); }
+};
+
+struct AstcCachedBlock
+{
+	AstcBlockKey Key;
+	uint8_t Texels[ASTC_MAX_BLOCK_TEXEL_COUNT * 4];
+};
+
+// ڵ     ֱٿ   մϴ.
+//   ݺؼ øϴ  (ؼ ˻, Ʈ  ) ڵ  ٿݴϴ.
+//   (   ) ġ ޶   ڵ˴ϴ.
+struct AstcBlockCache
+{
+	int BlockWidth = 4;
+	int BlockHeight = 4;
+	size_t Capacity = 0;
+
+	size_t HitCount = 0;
+	size_t MissCount = 0;
+
+	std::list<AstcCachedBlock> Blocks; // ϼ ֱٿ  Դϴ.
+	std::unordered_map<AstcBlockKey, std::list<AstcCachedBlock>::iterator, AstcBlockKeyHash> BlockIndices;
+};
+
+void InitializeAstcBlockCache(AstcBlockCache* cache, int blockWidth, int blockHeight, size_t capacity);
+
+// ĳø   ڵմϴ. ȯ ʹ  ĳ÷  ڵ ϱ  ȿմϴ.
+const uint8_t* DecodeAstcBlockCached(AstcBlockCache* cache, const uint8_t* blockData);
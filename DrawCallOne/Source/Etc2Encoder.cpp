@@ -0,0 +1,309 @@
+#include "Etc2Encoder.h"
+
+#include <cassert>
+#include <climits>
+#include <algorithm>
+
+/*
+	  Ʒ  ϼ
+	https://registry.khronos.org/DataFormat/specs/1.3/dataformat.1.3.html#ETC2
+	 8Ʈ EAC ,  8Ʈ ETC2 ̸   Դϴ.
+	ȼ ε  켱(x * 4 + y) Դϴ.
+*/
+
+/*** Constant Variables ***/
+static constexpr int ETC1_MODIFIER_TABLES[8][4] =
+{
+	{ 2, 8, -2, -8 }, { 5, 17, -5, -17 }, { 9, 29, -9, -29 }, { 13, 42, -13, -42 }
+	, { 18, 60, -18, -60 }, { 24, 80, -24, -80 }, { 33, 106, -33, -106 }, { 47, 183, -47, -183 }
+};
+
+static constexpr int EAC_MODIFIER_TABLES[16][8] =
+{
+	{ -3, -6, -9, -15, 2, 5, 8, 14 }, { -3, -7, -10, -13, 2, 6, 9, 12 }
+	, { -2, -5, -8, -13, 1, 4, 7, 12 }, { -2, -4, -6, -13, 1, 3, 5, 12 }
+	, { -3, -6, -8, -12, 2, 5, 7, 11 }, { -3, -7, -9, -11, 2, 6, 8, 10 }
+	, { -4, -7, -8, -11, 3, 6, 7, 10 }, { -3, -5, -8, -11, 2, 4, 7, 10 }
+	, { -2, -6, -8, -10, 1, 5, 7, 9 }, { -2, -5, -8, -10, 1, 4, 7, 9 }
+	, { -2, -4, -8, -10, 1, 3, 7, 9 }, { -2, -5, -7, -10, 1, 4, 6, 9 }
+	, { -3, -4, -7, -10, 2, 3, 6, 9 }, { -1, -2, -3, -10, 0, 1, 2, 9 }
+	, { -4, -6, -8, -9, 3, 5, 7, 8 }, { -3, -5, -7, -9, 2, 4, 6, 8 }
+};
+
+/*** Global Functions ***/
+static uint64_t EncodeEacAlpha(const uint8_t* texels);
+static uint64_t EncodeEtc1Color(const uint8_t* texels);
+static int EncodeEtc1SubBlock(const uint8_t* texels, const int* pixels, const int* baseColor, int* outTable, int* outIndices);
+static void WriteBigEndian(uint64_t value, uint8_t* outData);
+
+void EncodeEtc2RgbaBlock(const uint8_t* texels, uint8_t* outBlock)
+{
+	assert(texels != nullptr && outBlock != nullptr);
+
+	WriteBigEndian(EncodeEacAlpha(texels), outBlock);
+	WriteBigEndian(EncodeEtc1Color(texels), outBlock + 8);
+}
+
+uint64_t EncodeEacAlpha(const uint8_t* texels)
+{
+	int minAlpha = 255;
+	int maxAlpha = 0;
+
+	for (int i = 0; i < 16; ++i)
+	{
+		minAlpha = std::min<int>(minAlpha, texels[i * 4 + 3]);
+		maxAlpha = std::max<int>(maxAlpha, texels[i * 4 + 3]);
+	}
+
+	// İ ϸ 13 ̺ 0  մϴ.    κ ⿡ شմϴ.
+	if (minAlpha == maxAlpha)
+	{
+		uint64_t block = (static_cast<uint64_t>(minAlpha) << 56) | (1ull << 52) | (13ull << 48);
+
+		for (int i = 0; i < 16; ++i)
+		{
+			block |= 4ull << (45 - i * 3);
+		}
+
+		return block;
+	}
+
+	//     ΰ ̺         ãϴ.
+	const int baseAlpha = (minAlpha + maxAlpha + 1) / 2;
+
+	uint64_t bestBlock = 0;
+	int bestError = INT_MAX;
+
+	for (int table = 0; table < 16; ++table)
+	{
+		const int* modifiers = EAC_MODIFIER_TABLES[table];
+		const int span = modifiers[7] - modifiers[3];
+		const int multiplier = std::min(std::max((maxAlpha - minAlpha + span / 2) / span, 1), 15);
+
+		uint64_t block = (static_cast<uint64_t>(baseAlpha) << 56) | (static_cast<uint64_t>(multiplier) << 52) | (static_cast<uint64_t>(table) << 48);
+		int error = 0;
+
+		for (int x = 0; x < 4; ++x)
+		{
+			for (int y = 0; y < 4; ++y)
+			{
+				const int alpha = texels[(y * 4 + x) * 4 + 3];
+
+				int bestIndex = 0;
+				int bestIndexError = INT_MAX;
+
+				for (int index = 0; index < 8; ++index)
+				{
+					const int decodedAlpha = std::min(std::max(baseAlpha + modifiers[index] * multiplier, 0), 255);
+					const int indexError = (decodedAlpha - alpha) * (decodedAlpha - alpha);
+
+					if (indexError < bestIndexError)
+					{
+						bestIndex = index;
+						bestIndexError = indexError;
+					}
+				}
+
+				block |= static_cast<uint64_t>(bestIndex) << (45 - (x * 4 + y) * 3);
+				error += bestIndexError;
+			}
+		}
+
+		if (error < bestError)
+		{
+			bestBlock = block;
+			bestError = error;
+		}
+	}
+
+	return bestBlock;
+}
+
+uint64_t EncodeEtc1Color(const uint8_t* texels)
+{
+	// ¿(flip 0) (flip 1)       õմϴ.
+	uint64_t bestBlock = 0;
+	int bestError = INT_MAX;
+
+	for (int flip = 0; flip < 2; ++flip)
+	{
+		int subBlockPixels[2][8];
+		int averageColors[2][3];
+
+		for (int subBlock = 0; subBlock < 2; ++subBlock)
+		{
+			//  ؼ   Ƿ ķ ġ   մϴ.
+			int colorSums[3] = {};
+			int weightSum = 0;
+			int pixelCount = 0;
+
+			for (int y = 0; y < 4; ++y)
+			{
+				for (int x = 0; x < 4; ++x)
+				{
+					if ((flip == 0 ? x / 2 : y / 2) != subBlock)
+					{
+						continue;
+					}
+
+					const int texel = y * 4 + x;
+					const int weight = texels[texel * 4 + 3] + 1;
+
+					for (int i = 0; i < 3; ++i)
+					{
+						colorSums[i] += texels[texel * 4 + i] * weight;
+					}
+
+					weightSum += weight;
+					subBlockPixels[subBlock][pixelCount++] = texel;
+				}
+			}
+
+			for (int i = 0; i < 3; ++i)
+			{
+				averageColors[subBlock][i] = (colorSums[i] + weightSum / 2) / weightSum;
+			}
+		}
+
+		//    5Ʈ  ̰ -4~3̸  , ƴϸ 4Ʈ  带 մϴ.
+		int quantizedColors[2][3];
+		int baseColors[2][3];
+		bool bDifferential = true;
+
+		for (int i = 0; i < 3; ++i)
+		{
+			quantizedColors[0][i] = (averageColors[0][i] * 31 + 127) / 255;
+			quantizedColors[1][i] = (averageColors[1][i] * 31 + 127) / 255;
+
+			const int difference = quantizedColors[1][i] - quantizedColors[0][i];
+			bDifferential = bDifferential && difference >= -4 && difference <= 3;
+		}
+
+		if (bDifferential == false)
+		{
+			for (int subBlock = 0; subBlock < 2; ++subBlock)
+			{
+				for (int i = 0; i < 3; ++i)
+				{
+					quantizedColors[subBlock][i] = (averageColors[subBlock][i] * 15 + 127) / 255;
+					baseColors[subBlock][i] = quantizedColors[subBlock][i] * 17;
+				}
+			}
+		}
+		else
+		{
+			for (int subBlock = 0; subBlock < 2; ++subBlock)
+			{
+				for (int i = 0; i < 3; ++i)
+				{
+					baseColors[subBlock][i] = (quantizedColors[subBlock][i] << 3) | (quantizedColors[subBlock][i] >> 2);
+				}
+			}
+		}
+
+		int tables[2];
+		int indices[2][8];
+		const int error = EncodeEtc1SubBlock(texels, subBlockPixels[0], baseColors[0], &tables[0], indices[0])
+			+ EncodeEtc1SubBlock(texels, subBlockPixels[1], baseColors[1], &tables[1], indices[1]);
+
+		if (error >= bestError)
+		{
+			continue;
+		}
+
+		uint64_t block = 0;
+
+		for (int i = 0; i < 3; ++i)
+		{
+			const int shift = 56 - i * 8;
+
+			if (bDifferential)
+			{
+				block |= static_cast<uint64_t>(quantizedColors[0][i]) << (shift + 3);
+				block |= static_cast<uint64_t>((quantizedColors[1][i] - quantizedColors[0][i]) & 7) << shift;
+			}
+			else
+			{
+				block |= static_cast<uint64_t>(quantizedColors[0][i]) << (shift + 4);
+				block |= static_cast<uint64_t>(quantizedColors[1][i]) << shift;
+			}
+		}
+
+		block |= static_cast<uint64_t>(tables[0]) << 37;
+		block |= static_cast<uint64_t>(tables[1]) << 34;
+		block |= static_cast<uint64_t>(bDifferential ? 1 : 0) << 33;
+		block |= static_cast<uint64_t>(flip) << 32;
+
+		for (int subBlock = 0; subBlock < 2; ++subBlock)
+		{
+			for (int i = 0; i < 8; ++i)
+			{
+				const int texel = subBlockPixels[subBlock][i];
+				const int pixel = (texel % 4) * 4 + texel / 4;
+
+				block |= static_cast<uint64_t>(indices[subBlock][i] >> 1) << (16 + pixel);
+				block |= static_cast<uint64_t>(indices[subBlock][i] & 1) << pixel;
+			}
+		}
+
+		bestBlock = block;
+		bestError = error;
+	}
+
+	return bestBlock;
+}
+
+int EncodeEtc1SubBlock(const uint8_t* texels, const int* pixels, const int* baseColor, int* outTable, int* outIndices)
+{
+	int bestError = INT_MAX;
+
+	for (int table = 0; table < 8; ++table)
+	{
+		int indices[8];
+		int error = 0;
+
+		for (int i = 0; i < 8; ++i)
+		{
+			const uint8_t* texel = texels + pixels[i] * 4;
+			const int weight = texel[3] + 1;
+
+			int bestIndexError = INT_MAX;
+
+			for (int index = 0; index < 4; ++index)
+			{
+				int indexError = 0;
+
+				for (int j = 0; j < 3; ++j)
+				{
+					const int decodedColor = std::min(std::max(baseColor[j] + ETC1_MODIFIER_TABLES[table][index], 0), 255);
+					indexError += (decodedColor - texel[j]) * (decodedColor - texel[j]);
+				}
+
+				if (indexError < bestIndexError)
+				{
+					indices[i] = index;
+					bestIndexError = indexError;
+				}
+			}
+
+			error += bestIndexError * weight;
+		}
+
+		if (error < bestError)
+		{
+			bestError = error;
+			*outTable = table;
+			std::copy(indices, indices + 8, outIndices);
+		}
+	}
+
+	return bestError;
+}
+
+void WriteBigEndian(uint64_t value, uint8_t* outData)
+{
+	for (int i = 0; i < 8; ++i)
+	{
+		outData[i] = static_cast<uint8_t>(value >> (56 - i * 8));
+	}
+}
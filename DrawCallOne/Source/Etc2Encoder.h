@@ -0,0 +1,17 @@
+#pragma once
+
+/*
+	RGBA8 ؼ ETC2 RGBA8(EAC )  ϴ  ڴԴϴ.
+	ETC2 OpenGLES 3.0 ʼ ̹Ƿ ASTC  ʴ  ü  մϴ.
+
+	ȭ ӵ 켱Ͽ ETC1 ȣȯ (, ) մϴ.
+	 ũⰡ ASTC 4x4  16Ʈ̹Ƿ ؽó  ּ  ״   ֽϴ.
+*/
+
+#include <cstdint>
+#include <cstddef>
+
+static constexpr size_t ETC2_RGBA_BLOCK_SIZE = 16;
+
+// 4x4 RGBA8 ؼ( 켱) ETC2 RGBA8  ϳ մϴ.
+void EncodeEtc2RgbaBlock(const uint8_t* texels, uint8_t* outBlock);
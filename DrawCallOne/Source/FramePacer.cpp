@@ -0,0 +1,137 @@
+#include "FramePacer.h"
+
+#include <cassert>
+#include <cmath>
+#include <chrono>
+#include <thread>
+#include <algorithm>
+
+/*** Namespaces ***/
+using Clock = std::chrono::steady_clock;
+
+/*** Constant Variables ***/
+static constexpr double INITIAL_SLEEP_ESTIMATE = 0.002; // ϱ  ϴ 1и Sleep  ()Դϴ.
+
+/*** Global Variables ***/
+static double FramePeriod = 1.0 / 60.0;
+static Clock::time_point NextFrameTime;
+static Clock::time_point LastFrameTime;
+
+// 1и Sleep  ɸ ð հ л(Welford )Դϴ.
+static double SleepMean = INITIAL_SLEEP_ESTIMATE;
+static double SleepM2 = 0.0;
+static uint64_t SleepCount = 1;
+
+static FramePacerStats Stats = {};
+static double FrameTimeSum = 0.0;
+static double FrameTimeDeviationSquareSum = 0.0;
+
+/*** Global Functions ***/
+static void SleepUntil(Clock::time_point deadline);
+static void RecordFrameTime(double frameTime);
+
+void InitializeFramePacer(double targetFrameRate)
+{
+	assert(targetFrameRate > 0.0);
+
+	FramePeriod = 1.0 / targetFrameRate;
+
+	ResumeFramePacer();
+	ResetFramePacerStats();
+}
+
+double WaitForNextFrame()
+{
+	SleepUntil(NextFrameTime);
+
+	const Clock::time_point now = Clock::now();
+	const Clock::duration period = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(FramePeriod));
+
+	//  ֱ ̻ ʾ  ޾   ʰ   ٽ ϴ.
+	if (now - NextFrameTime > period)
+	{
+		NextFrameTime = now + period;
+		++Stats.LateFrameCount;
+	}
+	else
+	{
+		NextFrameTime += period;
+	}
+
+	const double frameTime = std::chrono::duration<double>(now - LastFrameTime).count();
+	LastFrameTime = now;
+
+	RecordFrameTime(frameTime);
+
+	return frameTime;
+}
+
+void ResumeFramePacer()
+{
+	LastFrameTime = Clock::now();
+	NextFrameTime = LastFrameTime + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(FramePeriod));
+}
+
+const FramePacerStats& GetFramePacerStats()
+{
+	return Stats;
+}
+
+void ResetFramePacerStats()
+{
+	Stats = {};
+	FrameTimeSum = 0.0;
+	FrameTimeDeviationSquareSum = 0.0;
+}
+
+void PrintFramePacerStats(FILE* stream)
+{
+	assert(stream != nullptr);
+
+	fprintf(stream, "Frame pacing (target %.2f ms): %u frames, average %.3f ms, jitter %.3f ms, max deviation %.3f ms, late %u\n"
+		, FramePeriod * 1000.0, Stats.FrameCount, Stats.AverageFrameTime, Stats.FrameTimeJitter, Stats.MaxFrameTimeDeviation, Stats.LateFrameCount);
+}
+
+void SleepUntil(Clock::time_point deadline)
+{
+	//  ð Sleep    ( + ǥ )   ϴ.
+	for (;;)
+	{
+		const double remainingTime = std::chrono::duration<double>(deadline - Clock::now()).count();
+		const double sleepEstimate = SleepMean + std::sqrt(SleepM2 / SleepCount);
+
+		if (remainingTime <= sleepEstimate)
+		{
+			break;
+		}
+
+		const Clock::time_point sleepStartTime = Clock::now();
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		const double sleepTime = std::chrono::duration<double>(Clock::now() - sleepStartTime).count();
+
+		++SleepCount;
+		const double delta = sleepTime - SleepMean;
+		SleepMean += delta / SleepCount;
+		SleepM2 += delta * (sleepTime - SleepMean);
+	}
+
+	//  ϸ ٸϴ.  ھ ٸ ( ) и ʵ 纸մϴ.
+	while (Clock::now() < deadline)
+	{
+		std::this_thread::yield();
+	}
+}
+
+void RecordFrameTime(double frameTime)
+{
+	const double frameTimeMs = frameTime * 1000.0;
+	const double deviation = frameTimeMs - FramePeriod * 1000.0;
+
+	++Stats.FrameCount;
+	FrameTimeSum += frameTimeMs;
+	FrameTimeDeviationSquareSum += deviation * deviation;
+
+	Stats.AverageFrameTime = FrameTimeSum / Stats.FrameCount;
+	Stats.FrameTimeJitter = std::sqrt(FrameTimeDeviationSquareSum / Stats.FrameCount);
+	Stats.MaxFrameTimeDeviation = std::max(Stats.MaxFrameTimeDeviation, std::abs(deviation));
+}
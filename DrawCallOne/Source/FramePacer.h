@@ -0,0 +1,38 @@
+#pragma once
+
+/*
+	ǥ  Ʈ    ð ߴ  ̼Դϴ.
+	ý ð ٲ   ʵ  ð(steady_clock) մϴ.
+
+	OS Sleep ٷ  ʰ    ð     ϸ ٸϴ.
+	 ð   ð ؼ ⸶ ˸° ˴ϴ.
+	 ð   ð ֱ⸦  ϹǷ ʰ    ʽϴ.
+*/
+
+#include <cstdint>
+#include <cstdio>
+
+struct FramePacerStats
+{
+	uint32_t FrameCount;
+	uint32_t LateFrameCount; //  ð  ֱ ̻ ģ  Դϴ.
+	double AverageFrameTime; // и Դϴ.
+	double FrameTimeJitter; //  ð ǥ ֱ⿡     (и)Դϴ.
+	double MaxFrameTimeDeviation; //  ð ǥ ֱ  ִ(и)Դϴ.
+};
+
+// ǥ  Ʈ(Hz) ϰ ð踦 ʱȭմϴ.
+void InitializeFramePacer(double targetFrameRate);
+
+//    ð ٸ    () ȯմϴ.
+double WaitForNextFrame();
+
+// ѵ WaitForNextFrame ȣ ʾҴٰ ٽ   ȣմϴ.  ð  ð 迡  ʰ ݺ ֱ⸦ ϴ.
+void ResumeFramePacer();
+
+//  ʱȭ  Դϴ.
+const FramePacerStats& GetFramePacerStats();
+
+void ResetFramePacerStats();
+
+void PrintFramePacerStats(FILE* stream);
@@ -0,0 +1,33 @@
+#pragma once
+
+/*
+	gl Լ ȣ δ GL_CALL ũԴϴ. GL ȣϴ  ҽ    ϳ  մϴ.
+	 忡 ȣ  glGetError  ˻ϰ   ſ ϴ.
+*/
+
+#include <cstdio>
+
+#include <GLES3/gl31.h>
+
+// ſ ϴ. __debugbreak MSVC Ƿ ٸ ÷ SIGTRAP ϴ.
+#ifdef _WIN32
+	#define DEBUG_BREAK() __debugbreak()
+#else
+	#include <csignal>
+	#define DEBUG_BREAK() raise(SIGTRAP)
+#endif
+
+#ifdef _DEBUG // gl Լ ȣ   ִ ˻մϴ.    ۵մϴ.
+	#define GL_CALL(x) \
+			(x); \
+			{ \
+				GLenum errorLog; \
+				if ((errorLog = glGetError()) != GL_NO_ERROR) \
+				{ \
+					printf("OpenGL Error: 0x%X\n", errorLog); \
+					DEBUG_BREAK(); \
+				} \
+			}
+#else
+	#define GL_CALL(x) (x);
+#endif
@@ -0,0 +1,317 @@
+#include "GlStateCache.h"
+#include "GlCall.h"
+
+#include <cassert>
+
+/*** Structures ***/
+struct GlState
+{
+	GLuint ArrayBuffer;
+	GLuint ElementArrayBuffer;
+	GLuint UniformBuffer;
+	GLuint VertexArray;
+	GLuint ShaderProgram;
+	GLuint ActiveTextureUnit;
+	GLuint Textures2D[GL_STATE_CACHE_TEXTURE_UNIT_COUNT];
+	GLuint TextureArrays[GL_STATE_CACHE_TEXTURE_UNIT_COUNT];
+	bool bBlend;
+	bool bDepthTest;
+	bool bScissorTest;
+	GLenum BlendSourceFactor;
+	GLenum BlendDestinationFactor;
+	GLenum BlendAlphaSourceFactor;
+	GLenum BlendAlphaDestinationFactor;
+	bool bDepthWrite;
+	GLint Scissor[4];
+	GLuint Framebuffer;
+};
+
+/*** Constant Variables ***/
+static constexpr GLuint UNKNOWN_BINDING = 0xFFFFFFFF; //  ü εǾ ִ 𸣴 Դϴ.
+
+/*** Global Variables ***/
+static GlState State = {};
+static GlStateCacheStats FrameStats = {};
+static GlStateCacheStats LastFrameStats = {};
+
+/*** Global Functions ***/
+static bool IsStateChanged(bool bChanged);
+
+void ResetGlStateCache()
+{
+	GL_CALL(glBindVertexArray(0));
+	GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, 0));
+	GL_CALL(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0));
+	GL_CALL(glBindBuffer(GL_UNIFORM_BUFFER, 0));
+	GL_CALL(glUseProgram(0));
+
+	for (GLuint unit = 0; unit < GL_STATE_CACHE_TEXTURE_UNIT_COUNT; ++unit)
+	{
+		GL_CALL(glActiveTexture(GL_TEXTURE0 + unit));
+		GL_CALL(glBindTexture(GL_TEXTURE_2D, 0));
+		GL_CALL(glBindTexture(GL_TEXTURE_2D_ARRAY, 0));
+	}
+
+	GL_CALL(glActiveTexture(GL_TEXTURE0));
+	GL_CALL(glDisable(GL_BLEND));
+	GL_CALL(glDisable(GL_DEPTH_TEST));
+	GL_CALL(glDisable(GL_SCISSOR_TEST));
+	GL_CALL(glBlendFunc(GL_ONE, GL_ZERO));
+	GL_CALL(glDepthMask(GL_TRUE));
+	GL_CALL(glScissor(0, 0, 0, 0));
+	GL_CALL(glBindFramebuffer(GL_FRAMEBUFFER, 0));
+
+	State = {};
+	State.BlendSourceFactor = GL_ONE;
+	State.BlendDestinationFactor = GL_ZERO;
+	State.BlendAlphaSourceFactor = GL_ONE;
+	State.BlendAlphaDestinationFactor = GL_ZERO;
+	State.bDepthWrite = true;
+}
+
+void BindGlBuffer(GLenum target, GLuint buffer)
+{
+	assert(target == GL_ARRAY_BUFFER || target == GL_ELEMENT_ARRAY_BUFFER || target == GL_UNIFORM_BUFFER);
+
+	GLuint& boundBuffer = target == GL_ARRAY_BUFFER ? State.ArrayBuffer : (target == GL_ELEMENT_ARRAY_BUFFER ? State.ElementArrayBuffer : State.UniformBuffer);
+
+	if (IsStateChanged(boundBuffer != buffer))
+	{
+		GL_CALL(glBindBuffer(target, buffer));
+		boundBuffer = buffer;
+	}
+}
+
+void BindGlVertexArray(GLuint vertexArray)
+{
+	if (IsStateChanged(State.VertexArray != vertexArray))
+	{
+		GL_CALL(glBindVertexArray(vertexArray));
+		State.VertexArray = vertexArray;
+
+		// ε  ε VAO  Ƿ  VAO  εǾ ִ   ϴ.
+		State.ElementArrayBuffer = UNKNOWN_BINDING;
+	}
+}
+
+void UseGlProgram(GLuint shaderProgram)
+{
+	if (IsStateChanged(State.ShaderProgram != shaderProgram))
+	{
+		GL_CALL(glUseProgram(shaderProgram));
+		State.ShaderProgram = shaderProgram;
+	}
+}
+
+void BindGlTexture(GLuint unit, GLenum target, GLuint texture)
+{
+	assert(unit < GL_STATE_CACHE_TEXTURE_UNIT_COUNT);
+	assert(target == GL_TEXTURE_2D || target == GL_TEXTURE_2D_ARRAY);
+
+	GLuint& boundTexture = target == GL_TEXTURE_2D ? State.Textures2D[unit] : State.TextureArrays[unit];
+
+	if (IsStateChanged(boundTexture != texture) == false)
+	{
+		return;
+	}
+
+	//    glActiveTexture θ ʿ䰡   ǳʶ ȣ ƴϹǷ ǳʶ ȣ   ʽϴ.
+	if (State.ActiveTextureUnit != unit)
+	{
+		GL_CALL(glActiveTexture(GL_TEXTURE0 + unit));
+		State.ActiveTextureUnit = unit;
+		++FrameStats.IssuedCallCount;
+	}
+
+	GL_CALL(glBindTexture(target, texture));
+	boundTexture = texture;
+}
+
+void SetGlCapability(GLenum capability, bool bEnabled)
+{
+	bool* bCapabilityEnabled = nullptr;
+
+	switch (capability)
+	{
+	case GL_BLEND:
+		bCapabilityEnabled = &State.bBlend;
+		break;
+
+	case GL_DEPTH_TEST:
+		bCapabilityEnabled = &State.bDepthTest;
+		break;
+
+	case GL_SCISSOR_TEST:
+		bCapabilityEnabled = &State.bScissorTest;
+		break;
+
+	default:
+		assert(false && "the capability is not tracked");
+		return;
+	}
+
+	if (IsStateChanged(*bCapabilityEnabled != bEnabled))
+	{
+		if (bEnabled)
+		{
+			GL_CALL(glEnable(capability));
+		}
+		else
+		{
+			GL_CALL(glDisable(capability));
+		}
+
+		*bCapabilityEnabled = bEnabled;
+	}
+}
+
+void SetGlBlendFunc(GLenum sourceFactor, GLenum destinationFactor)
+{
+	SetGlBlendFuncSeparate(sourceFactor, destinationFactor, sourceFactor, destinationFactor);
+}
+
+void SetGlBlendFuncSeparate(GLenum sourceFactor, GLenum destinationFactor, GLenum alphaSourceFactor, GLenum alphaDestinationFactor)
+{
+	if (IsStateChanged(State.BlendSourceFactor != sourceFactor || State.BlendDestinationFactor != destinationFactor
+		|| State.BlendAlphaSourceFactor != alphaSourceFactor || State.BlendAlphaDestinationFactor != alphaDestinationFactor))
+	{
+		GL_CALL(glBlendFuncSeparate(sourceFactor, destinationFactor, alphaSourceFactor, alphaDestinationFactor));
+		State.BlendSourceFactor = sourceFactor;
+		State.BlendDestinationFactor = destinationFactor;
+		State.BlendAlphaSourceFactor = alphaSourceFactor;
+		State.BlendAlphaDestinationFactor = alphaDestinationFactor;
+	}
+}
+
+void BindGlFramebuffer(GLuint framebuffer)
+{
+	if (IsStateChanged(State.Framebuffer != framebuffer))
+	{
+		GL_CALL(glBindFramebuffer(GL_FRAMEBUFFER, framebuffer));
+		State.Framebuffer = framebuffer;
+	}
+}
+
+void SetGlDepthMask(bool bDepthWrite)
+{
+	if (IsStateChanged(State.bDepthWrite != bDepthWrite))
+	{
+		GL_CALL(glDepthMask(bDepthWrite ? GL_TRUE : GL_FALSE));
+		State.bDepthWrite = bDepthWrite;
+	}
+}
+
+void SetGlScissor(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+	if (IsStateChanged(State.Scissor[0] != x || State.Scissor[1] != y || State.Scissor[2] != width || State.Scissor[3] != height))
+	{
+		GL_CALL(glScissor(x, y, width, height));
+		State.Scissor[0] = x;
+		State.Scissor[1] = y;
+		State.Scissor[2] = width;
+		State.Scissor[3] = height;
+	}
+}
+
+void DeleteGlBuffer(GLuint* buffer)
+{
+	assert(buffer != nullptr);
+
+	GL_CALL(glDeleteBuffers(1, buffer));
+
+	if (State.ArrayBuffer == *buffer)
+	{
+		State.ArrayBuffer = 0;
+	}
+
+	if (State.ElementArrayBuffer == *buffer)
+	{
+		State.ElementArrayBuffer = 0;
+	}
+
+	if (State.UniformBuffer == *buffer)
+	{
+		State.UniformBuffer = 0;
+	}
+}
+
+void DeleteGlVertexArray(GLuint* vertexArray)
+{
+	assert(vertexArray != nullptr);
+
+	GL_CALL(glDeleteVertexArrays(1, vertexArray));
+
+	if (State.VertexArray == *vertexArray)
+	{
+		State.VertexArray = 0;
+		State.ElementArrayBuffer = 0;
+	}
+}
+
+void DeleteGlTexture(GLuint* texture)
+{
+	assert(texture != nullptr);
+
+	GL_CALL(glDeleteTextures(1, texture));
+
+	for (GLuint unit = 0; unit < GL_STATE_CACHE_TEXTURE_UNIT_COUNT; ++unit)
+	{
+		if (State.Textures2D[unit] == *texture)
+		{
+			State.Textures2D[unit] = 0;
+		}
+
+		if (State.TextureArrays[unit] == *texture)
+		{
+			State.TextureArrays[unit] = 0;
+		}
+	}
+}
+
+void DeleteGlFramebuffer(GLuint* framebuffer)
+{
+	assert(framebuffer != nullptr);
+
+	GL_CALL(glDeleteFramebuffers(1, framebuffer));
+
+	if (State.Framebuffer == *framebuffer)
+	{
+		State.Framebuffer = 0;
+	}
+}
+
+const GlStateCacheStats& GetGlStateCacheStats()
+{
+	return LastFrameStats;
+}
+
+void EndGlStateCacheFrame()
+{
+	LastFrameStats = FrameStats;
+	FrameStats = {};
+}
+
+void PrintGlStateCacheStats(FILE* stream)
+{
+	assert(stream != nullptr);
+
+	const uint32_t callCount = LastFrameStats.IssuedCallCount + LastFrameStats.SkippedCallCount;
+
+	fprintf(stream, "GL state calls per frame: %u issued, %u skipped (%.1f%%)\n"
+		, LastFrameStats.IssuedCallCount, LastFrameStats.SkippedCallCount
+		, callCount > 0 ? 100.0 * LastFrameStats.SkippedCallCount / callCount : 0.0);
+}
+
+bool IsStateChanged(bool bChanged)
+{
+	if (bChanged)
+	{
+		++FrameStats.IssuedCallCount;
+	}
+	else
+	{
+		++FrameStats.SkippedCallCount;
+	}
+
+	return bChanged;
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+/*
+	 ϴ GL (, VAO, α׷, ؽó , , , ,  )  ΰ
+	̹   ٽ ϴ ȣ ̹  ʽϴ.
+	 ̶ GL ȣ⸶ ̹ ¸ ϹǷ Ͽ ǳʶ ȣ⸸ŭ CPU ð پϴ.
+
+	  ؽƮ  ϸ ؽƮ ϴ 忡 ȣؾ ˴ϴ.
+	 Լ ġ ʰ ¸ ٲٸ ResetGlStateCache ȣؼ  ٽ  ˴ϴ.
+*/
+
+#include <cstdint>
+#include <cstdio>
+
+#include <GLES3/gl31.h>
+
+static constexpr GLuint GL_STATE_CACHE_TEXTURE_UNIT_COUNT = 8;
+
+struct GlStateCacheStats
+{
+	uint32_t IssuedCallCount; // ̹  ȣ Դϴ.
+	uint32_t SkippedCallCount; //  Ƽ ǳʶ ȣ Դϴ.
+};
+
+// GL ¸ ⺻ ϰ ϵ   ϴ. ؽƮ  Ŀ ȣմϴ.
+void ResetGlStateCache();
+
+// GL_ARRAY_BUFFER, GL_ELEMENT_ARRAY_BUFFER, GL_UNIFORM_BUFFER մϴ. GL_ELEMENT_ARRAY_BUFFER VAO ϹǷ VAO ٲ ٽ մϴ.
+// glBindBufferBase ε Ʈ  ۴  ʽϴ.
+void BindGlBuffer(GLenum target, GLuint buffer);
+void BindGlVertexArray(GLuint vertexArray);
+void UseGlProgram(GLuint shaderProgram);
+
+//  ٲ glActiveTexture Բ ȣմϴ. GL_TEXTURE_2D GL_TEXTURE_2D_ARRAY մϴ.
+void BindGlTexture(GLuint unit, GLenum target, GLuint texture);
+
+// GL_BLEND, GL_DEPTH_TEST, GL_SCISSOR_TEST մϴ.
+void SetGlCapability(GLenum capability, bool bEnabled);
+void SetGlBlendFunc(GLenum sourceFactor, GLenum destinationFactor);
+void SetGlBlendFuncSeparate(GLenum sourceFactor, GLenum destinationFactor, GLenum alphaSourceFactor, GLenum alphaDestinationFactor);
+void SetGlDepthMask(bool bDepthWrite);
+void SetGlScissor(GLint x, GLint y, GLsizei width, GLsizei height);
+
+// GL_FRAMEBUFFER ε մϴ. 0 ⺻  Դϴ.
+void BindGlFramebuffer(GLuint framebuffer);
+
+//  ü εǾ ־ٸ GL ε 0 ǵǷ ϵ  ϴ.
+void DeleteGlBuffer(GLuint* buffer);
+void DeleteGlVertexArray(GLuint* vertexArray);
+void DeleteGlTexture(GLuint* texture);
+void DeleteGlFramebuffer(GLuint* framebuffer);
+
+//  EndGlStateCacheFrame ȣ  Դϴ.
+const GlStateCacheStats& GetGlStateCacheStats();
+
+//    ȣմϴ. ̹  踦 ϰ    ϴ.
+void EndGlStateCacheFrame();
+
+void PrintGlStateCacheStats(FILE* stream);
@@ -0,0 +1,116 @@
+#include "GpuMemory.h"
+
+#include <cassert>
+#include <algorithm>
+#include <unordered_map>
+
+/*** Constant Variables ***/
+static constexpr const char* CATEGORY_NAMES[GPU_MEMORY_CATEGORY_COUNT] =
+{
+	"Texture array",
+	"Instance buffers",
+	"Geometry",
+	"Render targets"
+};
+
+/*** Global Variables ***/
+static GpuMemoryStats Stats = {};
+static std::unordered_map<uint64_t, size_t> AllocationSizes; // (, ü ̸) Ҵ ũԴϴ.
+static bool bOverBudget = false;
+
+/*** Global Functions ***/
+static uint64_t GetAllocationKey(GpuMemoryCategory category, uint32_t objectName);
+static void CheckGpuMemoryBudget();
+
+void SetGpuMemoryBudget(size_t budget)
+{
+	Stats.Budget = budget;
+	bOverBudget = false;
+
+	CheckGpuMemoryBudget();
+}
+
+void TrackGpuMemoryAllocation(GpuMemoryCategory category, uint32_t objectName, size_t size)
+{
+	assert(category < GPU_MEMORY_CATEGORY_COUNT);
+
+	size_t& allocationSize = AllocationSizes[GetAllocationKey(category, objectName)];
+
+	Stats.CategorySizes[category] += size - allocationSize;
+	Stats.TotalSize += size - allocationSize;
+	allocationSize = size;
+
+	Stats.CategoryHighWaterMarks[category] = std::max(Stats.CategoryHighWaterMarks[category], Stats.CategorySizes[category]);
+	Stats.TotalHighWaterMark = std::max(Stats.TotalHighWaterMark, Stats.TotalSize);
+
+	CheckGpuMemoryBudget();
+}
+
+void TrackGpuMemoryRelease(GpuMemoryCategory category, uint32_t objectName)
+{
+	assert(category < GPU_MEMORY_CATEGORY_COUNT);
+
+	const auto& foundAllocation = AllocationSizes.find(GetAllocationKey(category, objectName));
+
+	if (foundAllocation == AllocationSizes.end())
+	{
+		return;
+	}
+
+	Stats.CategorySizes[category] -= foundAllocation->second;
+	Stats.TotalSize -= foundAllocation->second;
+	AllocationSizes.erase(foundAllocation);
+
+	CheckGpuMemoryBudget();
+}
+
+void SetGpuMemoryTextureWaste(size_t paddingSize, size_t unusedSize)
+{
+	Stats.TexturePaddingSize = paddingSize;
+	Stats.TextureUnusedSize = unusedSize;
+}
+
+const GpuMemoryStats& GetGpuMemoryStats()
+{
+	return Stats;
+}
+
+void PrintGpuMemoryStats(FILE* stream)
+{
+	assert(stream != nullptr);
+
+	fprintf(stream, "GPU memory: %.2f MB (peak %.2f MB)", Stats.TotalSize / 1048576.0, Stats.TotalHighWaterMark / 1048576.0);
+
+	if (Stats.Budget > 0)
+	{
+		fprintf(stream, " / budget %.2f MB", Stats.Budget / 1048576.0);
+	}
+
+	fprintf(stream, "\n");
+
+	for (int i = 0; i < GPU_MEMORY_CATEGORY_COUNT; ++i)
+	{
+		fprintf(stream, "  %-16s %10zu bytes (peak %zu)\n", CATEGORY_NAMES[i], Stats.CategorySizes[i], Stats.CategoryHighWaterMarks[i]);
+	}
+
+	fprintf(stream, "  Texture padding  %10zu bytes\n", Stats.TexturePaddingSize);
+	fprintf(stream, "  Texture unused   %10zu bytes\n", Stats.TextureUnusedSize);
+}
+
+uint64_t GetAllocationKey(GpuMemoryCategory category, uint32_t objectName)
+{
+	// ؽó ۴ ̸  ζ  ̸   Ƿ  Բ մϴ.
+	return (static_cast<uint64_t>(category) << 32) | objectName;
+}
+
+void CheckGpuMemoryBudget()
+{
+	const bool bExceeded = Stats.Budget > 0 && Stats.TotalSize > Stats.Budget;
+
+	if (bExceeded && bOverBudget == false)
+	{
+		fprintf(stderr, "GPU memory budget exceeded: %zu / %zu bytes\n", Stats.TotalSize, Stats.Budget);
+	}
+
+	bOverBudget = bExceeded;
+}
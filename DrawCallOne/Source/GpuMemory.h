@@ -0,0 +1,49 @@
+#pragma once
+
+/*
+	ؽó , νϽ ,    GL ü Ҵ  ޸𸮸  մϴ.
+	̹  ϴ   ٸ     ⿡  Ǵϱ⿡ մϴ.
+
+	GL ü ̸   ϹǷ  ü ٽ Ҵϸ  ũ⸦ üմϴ.
+	  Ѵ     մϴ.
+*/
+
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+
+enum GpuMemoryCategory
+{
+	GPU_MEMORY_TEXTURE_ARRAY,
+	GPU_MEMORY_INSTANCE_BUFFER,
+	GPU_MEMORY_GEOMETRY,
+	GPU_MEMORY_RENDER_TARGET,
+	GPU_MEMORY_CATEGORY_COUNT
+};
+
+struct GpuMemoryStats
+{
+	size_t CategorySizes[GPU_MEMORY_CATEGORY_COUNT];
+	size_t CategoryHighWaterMarks[GPU_MEMORY_CATEGORY_COUNT];
+	size_t TotalSize;
+	size_t TotalHighWaterMark;
+	size_t TexturePaddingSize; // ؽó ũ⸦ 4ȼ  ø鼭 Ǵ Ʈ Դϴ.
+	size_t TextureUnusedSize; // ؽó ̿ ƹ ؽó  ʴ Ʈ Դϴ.
+	size_t Budget; // 0̸  ˻ ʽϴ.
+};
+
+//  Ʈ  մϴ. ̹ Ѿ ٷ մϴ.
+void SetGpuMemoryBudget(size_t budget);
+
+// glBufferData, glTexStorage  Ҵ ũ⸦ մϴ.
+void TrackGpuMemoryAllocation(GpuMemoryCategory category, uint32_t objectName, size_t size);
+
+// glDelete*   ü Ͽ մϴ.
+void TrackGpuMemoryRelease(GpuMemoryCategory category, uint32_t objectName);
+
+// ؽó  ȿ Ǵ  մϴ. ü ũ ؽó  Ҵ翡 ̹ ԵǾ ֽϴ.
+void SetGpuMemoryTextureWaste(size_t paddingSize, size_t unusedSize);
+
+const GpuMemoryStats& GetGpuMemoryStats();
+
+void PrintGpuMemoryStats(FILE* stream);
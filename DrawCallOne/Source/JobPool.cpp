@@ -0,0 +1,157 @@
+#include "JobPool.h"
+
+#include <cassert>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*** Structures ***/
+// RunJobs   شϴ ۾ Դϴ. RunJobs  ̹Ƿ   ۾ 尡  ƾ ư  ֽϴ.
+struct JobBatch
+{
+	const std::function<void(uint32_t)>* Job;
+	uint32_t JobCount;
+	std::atomic<uint32_t> NextJob;
+	uint32_t BusyWorkerCount;
+};
+
+/*** Global Variables ***/
+static std::vector<std::thread> Workers;
+static std::mutex WorkerMutex;
+static std::condition_variable WorkerWakeCondition;
+static std::condition_variable WorkerDoneCondition;
+static bool bWorkersRunning = false;
+static std::vector<JobBatch*> PendingBatches; //    ۾  Դϴ. ۾     ϴ.
+
+/*** Global Functions ***/
+static void RunWorker();
+static void RunBatchJobs(JobBatch* batch);
+static void RemovePendingBatch(JobBatch* batch);
+
+void InitializeJobPool()
+{
+	assert(Workers.empty() && "InitializeJobPool called twice");
+
+	const uint32_t threadCount = std::max<uint32_t>(std::thread::hardware_concurrency(), 1);
+
+	bWorkersRunning = true;
+
+	for (uint32_t i = 1; i < threadCount; ++i)
+	{
+		Workers.emplace_back(RunWorker);
+	}
+}
+
+void ShutdownJobPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(WorkerMutex);
+		assert(PendingBatches.empty() && "ShutdownJobPool called while jobs are running");
+
+		bWorkersRunning = false;
+	}
+
+	WorkerWakeCondition.notify_all();
+
+	for (std::thread& worker : Workers)
+	{
+		worker.join();
+	}
+
+	Workers.clear();
+}
+
+uint32_t GetJobThreadCount()
+{
+	return static_cast<uint32_t>(Workers.size()) + 1;
+}
+
+void RunJobs(uint32_t jobCount, const std::function<void(uint32_t)>& job)
+{
+	if (jobCount == 0)
+	{
+		return;
+	}
+
+	// ۾ ϳ̸ ۾ 带  븸 ϴ.
+	if (jobCount == 1 || Workers.empty())
+	{
+		for (uint32_t i = 0; i < jobCount; ++i)
+		{
+			job(i);
+		}
+
+		return;
+	}
+
+	JobBatch batch;
+	batch.Job = &job;
+	batch.JobCount = jobCount;
+	batch.NextJob = 0;
+	batch.BusyWorkerCount = 0;
+
+	{
+		std::lock_guard<std::mutex> lock(WorkerMutex);
+		PendingBatches.push_back(&batch);
+	}
+
+	WorkerWakeCondition.notify_all();
+
+	RunBatchJobs(&batch);
+
+	//  ۾   Ƿ  ,  ۾ 尡   ٸϴ.
+	std::unique_lock<std::mutex> lock(WorkerMutex);
+	RemovePendingBatch(&batch);
+	WorkerDoneCondition.wait(lock, [&]() { return batch.BusyWorkerCount == 0; });
+}
+
+void RunWorker()
+{
+	std::unique_lock<std::mutex> lock(WorkerMutex);
+
+	while (true)
+	{
+		WorkerWakeCondition.wait(lock, []() { return PendingBatches.empty() == false || bWorkersRunning == false; });
+
+		if (bWorkersRunning == false)
+		{
+			return;
+		}
+
+		JobBatch* batch = PendingBatches.front();
+		++batch->BusyWorkerCount;
+
+		lock.unlock();
+		RunBatchJobs(batch);
+		lock.lock();
+
+		// ƿԴٸ   ۾ Ƿ ٸ ۾ 尡   ٽ  ʰ ϴ.
+		RemovePendingBatch(batch);
+
+		if (--batch->BusyWorkerCount == 0)
+		{
+			WorkerDoneCondition.notify_all();
+		}
+	}
+}
+
+void RunBatchJobs(JobBatch* batch)
+{
+	for (uint32_t job = batch->NextJob++; job < batch->JobCount; job = batch->NextJob++)
+	{
+		(*batch->Job)(job);
+	}
+}
+
+void RemovePendingBatch(JobBatch* batch)
+{
+	const auto pendingBatch = std::find(PendingBatches.begin(), PendingBatches.end(), batch);
+
+	if (pendingBatch != PendingBatches.end())
+	{
+		PendingBatches.erase(pendingBatch);
+	}
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+/*
+	, CPU ȭ, ؽó ȯ Բ  ۾  ǮԴϴ.
+	⸶ 带   ھ   尡  ð Ƿ    Ӵϴ.
+	RunJobs ȣ 嵵 ڱ ۾ óϹǷ ùķ̼   尡 ÿ ȣص ˴ϴ.
+
+	  RunJobs  ۾ ÿ ȴٴ  Ƿ ۾ θ ٸ  ˴ϴ.
+*/
+
+#include <cstdint>
+#include <functional>
+
+// ۾ 带 ϴ. ȣ 嵵 ۾ ϹǷ ھ  ϳ  ϴ.
+void InitializeJobPool();
+
+// ۾ 带 ϴ.  RunJobs ȣ 尡  óմϴ.
+void ShutdownJobPool();
+
+// ۾ ÿ ó  ִ  Դϴ. ȣ 带 ϸ ʱȭ ʾ 1Դϴ.
+uint32_t GetJobThreadCount();
+
+// job(0) job(jobCount - 1)  óϰ   ƿɴϴ.
+void RunJobs(uint32_t jobCount, const std::function<void(uint32_t)>& job);
@@ -0,0 +1,242 @@
+#include "Ktx2Reader.h"
+
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <algorithm>
+
+#ifdef KTX2_ZSTD_SUPPORT
+	#include <zstd.h>
+#endif
+
+/*** Structures ***/
+struct Ktx2Header
+{
+	uint8_t Identifier[12];
+	uint32_t VkFormat;
+	uint32_t TypeSize;
+	uint32_t PixelWidth;
+	uint32_t PixelHeight;
+	uint32_t PixelDepth;
+	uint32_t LayerCount;
+	uint32_t FaceCount;
+	uint32_t LevelCount;
+	uint32_t SupercompressionScheme;
+	uint32_t DfdByteOffset;
+	uint32_t DfdByteLength;
+	uint32_t KvdByteOffset;
+	uint32_t KvdByteLength;
+	uint64_t SgdByteOffset;
+	uint64_t SgdByteLength;
+};
+
+/*** Constant Variables ***/
+static constexpr uint8_t KTX2_IDENTIFIER[12] = { 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+
+static constexpr uint32_t VK_FORMAT_ASTC_4x4_UNORM_BLOCK = 157;
+static constexpr uint32_t VK_FORMAT_ASTC_4x4_SRGB_BLOCK = 158;
+
+// ջǰų   ū ޸𸮸  ϵ մϴ. GLES 3.1 ּ 尪 ˳մϴ.
+static constexpr uint32_t KTX2_MAX_PIXEL_SIZE = 16384;
+static constexpr uint32_t KTX2_MAX_LAYER_COUNT = 2048;
+
+static_assert(sizeof(Ktx2Header) == 80, "Ktx2Header must match the file layout");
+
+/*** Global Functions ***/
+static bool SeekKtx2File(FILE* ktx2Data, uint64_t offset, int origin);
+static uint64_t TellKtx2File(FILE* ktx2Data);
+static bool ValidateKtx2Levels(const char* filePath, const Ktx2File& file, uint64_t fileSize);
+
+bool OpenKtx2File(const char* filePath, Ktx2File* outFile)
+{
+	assert(filePath != nullptr && outFile != nullptr);
+
+	FILE* ktx2Data = fopen(filePath, "rb");
+
+	if (ktx2Data == nullptr)
+	{
+		return false;
+	}
+
+	Ktx2Header header;
+	bool bValid = fread(&header, sizeof(header), 1, ktx2Data) == 1
+		&& memcmp(header.Identifier, KTX2_IDENTIFIER, sizeof(KTX2_IDENTIFIER)) == 0;
+
+	// ؽó ̰ ASTC 4x4 ϹǷ ٸ ̳ 3D ؽó  ʽϴ.
+	if (bValid && (header.VkFormat != VK_FORMAT_ASTC_4x4_UNORM_BLOCK && header.VkFormat != VK_FORMAT_ASTC_4x4_SRGB_BLOCK))
+	{
+		fprintf(stderr, "%s: only ASTC 4x4 KTX2 files are supported\n", filePath);
+		bValid = false;
+	}
+
+	if (bValid && header.PixelDepth > 1)
+	{
+		fprintf(stderr, "%s: 3D KTX2 textures are not supported\n", filePath);
+		bValid = false;
+	}
+
+	if (bValid && header.SupercompressionScheme != KTX2_SUPERCOMPRESSION_NONE && header.SupercompressionScheme != KTX2_SUPERCOMPRESSION_ZSTD)
+	{
+		fprintf(stderr, "%s: unsupported supercompression scheme %u\n", filePath, header.SupercompressionScheme);
+		bValid = false;
+	}
+
+	//      ݾ ٿ 1      ϴ.
+	uint32_t maxLevelCount = 0;
+
+	for (uint32_t size = std::max(header.PixelWidth, header.PixelHeight); size > 0; size >>= 1)
+	{
+		++maxLevelCount;
+	}
+
+	if (bValid && (header.PixelWidth == 0 || header.PixelHeight == 0 || header.PixelWidth > KTX2_MAX_PIXEL_SIZE || header.PixelHeight > KTX2_MAX_PIXEL_SIZE
+		|| (header.FaceCount != 0 && header.FaceCount != 1 && header.FaceCount != 6)
+		|| header.LayerCount > KTX2_MAX_LAYER_COUNT
+		|| header.LevelCount > maxLevelCount))
+	{
+		fprintf(stderr, "%s: invalid KTX2 image size, layer count or level count\n", filePath);
+		bValid = false;
+	}
+
+	if (bValid)
+	{
+		outFile->FilePath = filePath;
+		outFile->VkFormat = header.VkFormat;
+		outFile->PixelWidth = header.PixelWidth;
+		outFile->PixelHeight = header.PixelHeight;
+		outFile->LayerCount = std::max(header.LayerCount, 1u) * std::max(header.FaceCount, 1u);
+		outFile->SupercompressionScheme = header.SupercompressionScheme;
+		outFile->Levels.resize(std::max(header.LevelCount, 1u));
+
+		//  ε  ٷ ڿ  64Ʈ    Ǿ ֽϴ.
+		bValid = fread(outFile->Levels.data(), sizeof(Ktx2Level), outFile->Levels.size(), ktx2Data) == outFile->Levels.size();
+	}
+
+	if (bValid)
+	{
+		bValid = SeekKtx2File(ktx2Data, 0, SEEK_END) && ValidateKtx2Levels(filePath, *outFile, TellKtx2File(ktx2Data));
+	}
+
+	fclose(ktx2Data);
+
+	return bValid;
+}
+
+void GetKtx2ImageSize(const Ktx2File& file, uint32_t level, uint32_t* outWidth, uint32_t* outHeight, size_t* outDataSize)
+{
+	assert(level < file.Levels.size());
+
+	*outWidth = std::max(file.PixelWidth >> level, 1u);
+	*outHeight = std::max(file.PixelHeight >> level, 1u);
+	*outDataSize = static_cast<size_t>((*outWidth + 3) / 4) * ((*outHeight + 3) / 4) * 16;
+}
+
+size_t GetKtx2LevelSize(const Ktx2File& file, uint32_t level)
+{
+	uint32_t width = 0;
+	uint32_t height = 0;
+	size_t imageDataSize = 0;
+
+	GetKtx2ImageSize(file, level, &width, &height, &imageDataSize);
+
+	return imageDataSize * file.LayerCount;
+}
+
+bool ReadKtx2Level(const Ktx2File& file, uint32_t level, uint8_t* outData, size_t outDataSize)
+{
+	assert(level < file.Levels.size() && outData != nullptr);
+
+	const Ktx2Level& levelIndex = file.Levels[level];
+
+	// OpenKtx2File ˻ߴ ȣ   ũ ٸ ġų  äǷ źմϴ.
+	if (levelIndex.UncompressedByteLength != outDataSize)
+	{
+		fprintf(stderr, "%s: level %u is %llu bytes but the buffer is %zu bytes\n"
+			, file.FilePath.c_str(), level, static_cast<unsigned long long>(levelIndex.UncompressedByteLength), outDataSize);
+		return false;
+	}
+
+	FILE* ktx2Data = fopen(file.FilePath.c_str(), "rb");
+
+	if (ktx2Data == nullptr)
+	{
+		return false;
+	}
+
+	const bool bSeeked = SeekKtx2File(ktx2Data, levelIndex.ByteOffset, SEEK_SET);
+	bool bRead = false;
+
+	if (bSeeked && file.SupercompressionScheme == KTX2_SUPERCOMPRESSION_NONE)
+	{
+		bRead = fread(outData, outDataSize, 1, ktx2Data) == 1;
+	}
+	else if (bSeeked)
+	{
+#ifdef KTX2_ZSTD_SUPPORT
+		auto compressedData = std::make_unique<uint8_t[]>(static_cast<size_t>(levelIndex.ByteLength));
+
+		if (fread(compressedData.get(), static_cast<size_t>(levelIndex.ByteLength), 1, ktx2Data) == 1)
+		{
+			const size_t decompressedSize = ZSTD_decompress(outData, outDataSize, compressedData.get(), static_cast<size_t>(levelIndex.ByteLength));
+
+			bRead = ZSTD_isError(decompressedSize) == 0 && decompressedSize == outDataSize;
+		}
+#else
+		fprintf(stderr, "%s: build with KTX2_ZSTD_SUPPORT to read Zstandard supercompressed files\n", file.FilePath.c_str());
+#endif
+	}
+
+	fclose(ktx2Data);
+
+	return bRead;
+}
+
+bool SeekKtx2File(FILE* ktx2Data, uint64_t offset, int origin)
+{
+	// long 32Ʈ Windows 2GB Ѵ  ߸ ʰ űϴ.
+#ifdef _WIN32
+	return _fseeki64(ktx2Data, static_cast<__int64>(offset), origin) == 0;
+#else
+	return fseeko(ktx2Data, static_cast<off_t>(offset), origin) == 0;
+#endif
+}
+
+uint64_t TellKtx2File(FILE* ktx2Data)
+{
+#ifdef _WIN32
+	const __int64 position = _ftelli64(ktx2Data);
+#else
+	const off_t position = ftello(ktx2Data);
+#endif
+
+	return position < 0 ? 0 : static_cast<uint64_t>(position);
+}
+
+bool ValidateKtx2Levels(const char* filePath, const Ktx2File& file, uint64_t fileSize)
+{
+	/*
+		 ̴ ߿ ״ ޸𸮸  д ũ̹Ƿ  ˻մϴ.
+		Ǯ ũ  ̹ ũ ̾  Ƿ Ȯ ƾ ϰ,  ʾ   ̵ ƾ մϴ.
+		ʹ  ȿ ־ ϹǷ  ũⰡ    ˴ϴ.
+	*/
+	for (uint32_t level = 0; level < file.Levels.size(); ++level)
+	{
+		const Ktx2Level& levelIndex = file.Levels[level];
+		const uint64_t expectedSize = GetKtx2LevelSize(file, level);
+
+		const bool bValid = levelIndex.UncompressedByteLength == expectedSize
+			&& levelIndex.ByteLength > 0
+			&& levelIndex.ByteOffset <= fileSize
+			&& levelIndex.ByteLength <= fileSize - levelIndex.ByteOffset
+			&& (file.SupercompressionScheme != KTX2_SUPERCOMPRESSION_NONE || levelIndex.ByteLength == expectedSize);
+
+		if (bValid == false)
+		{
+			fprintf(stderr, "%s: level %u has an invalid byte range or length\n", filePath, level);
+			return false;
+		}
+	}
+
+	return true;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+/*
+	KTX2 ̳ʿ ASTC 4x4 ̹ нϴ.
+	 ϳ  (̾, ť ) ̹     ְ  Zstandard   ֽϴ.
+	ASTC ʹ zstd 20~40%   پ   ũ ù ε I/O پϴ.
+
+	Zstandard  Ǯ KTX2_ZSTD_SUPPORT ϰ zstd ̺귯 ũؾ մϴ.
+	⺻ Ʈ  zstd Ƿ     KTX2 ϸ   ֽϴ.
+	KTX2 : https://registry.khronos.org/KTX/specs/2.0/ktxspec.v2.html
+*/
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+static constexpr uint32_t KTX2_SUPERCOMPRESSION_NONE = 0;
+static constexpr uint32_t KTX2_SUPERCOMPRESSION_ZSTD = 2;
+
+struct Ktx2Level
+{
+	uint64_t ByteOffset;
+	uint64_t ByteLength;
+	uint64_t UncompressedByteLength;
+};
+
+struct Ktx2File
+{
+	std::string FilePath;
+	uint32_t VkFormat = 0;
+	uint32_t PixelWidth = 0;
+	uint32_t PixelHeight = 0;
+	uint32_t LayerCount = 1; // ̾  * ť  Դϴ.
+	uint32_t SupercompressionScheme = KTX2_SUPERCOMPRESSION_NONE;
+	std::vector<Ktx2Level> Levels; // 0  ū Դϴ.
+};
+
+//    нϴ.   ߰ų ASTC 4x4  ƴϰų   ϰ   false ȯմϴ.
+bool OpenKtx2File(const char* filePath, Ktx2File* outFile);
+
+// ش  ̹     ũ  ũԴϴ.
+void GetKtx2ImageSize(const Ktx2File& file, uint32_t level, uint32_t* outWidth, uint32_t* outHeight, size_t* outDataSize);
+
+//  ϳ( ̾)  ũԴϴ. OpenKtx2File  UncompressedByteLength  ũ ٸ źմϴ.
+size_t GetKtx2LevelSize(const Ktx2File& file, uint32_t level);
+
+//  ϳ( ̾)  Ǯ outData մϴ. outDataSize  ũ ٸ  ʰ false ȯմϴ.
+// ȣ⸶      忡 ÿ ȣ  ֽϴ.
+bool ReadKtx2Level(const Ktx2File& file, uint32_t level, uint8_t* outData, size_t outDataSize);
@@ -0,0 +1,402 @@
+#include "NullRenderBackend.h"
+
+#include <cassert>
+#include <cstdio>
+
+#include "GpuMemory.h"
+#include "SpriteStyle.h"
+
+/*** Constant Variables ***/
+static constexpr uint32_t INSTANCE_BUFFER_NAME = 1; // GpuMemory   ϴ ¥ ü ̸Դϴ.
+static constexpr uint32_t TEXTURE_ARRAY_NAME = 2;
+static constexpr uint32_t LAYER_TARGET_NAME = 3; // ̾ LAYER_TARGET_NAME + layer մϴ.
+static constexpr uint32_t LAYER_DEPTH_BUFFER_NAME = LAYER_TARGET_NAME + CACHED_LAYER_COUNT;
+static constexpr int32_t RENDER_TARGET_WIDTH = 1280; // GL 鿣 ȭ ũԴϴ.
+static constexpr int32_t RENDER_TARGET_HEIGHT = 720;
+static constexpr size_t BLOCK_SIZE = 16;
+static constexpr size_t INSTANCE_SIZE = sizeof(glm::mat4) + sizeof(glm::uvec4) + sizeof(glm::uvec4); // GL 鿣尡 νϽ ϳ ø Ʈ Դϴ.
+static constexpr size_t CLIP_RECT_TABLE_SIZE = sizeof(glm::vec4) * MAX_CLIP_RECT_COUNT; // GL 鿣 Ŭ 簢   ũԴϴ.
+static constexpr size_t NINE_SLICE_BORDER_TABLE_SIZE = sizeof(glm::vec4) * MAX_NINE_SLICE_BORDER_COUNT;
+
+static constexpr const char* CALL_NAMES[NULL_RENDER_CALL_TYPE_COUNT] =
+{
+	"CreateTextureArray",
+	"UploadTextureArrayData",
+	"BeginFrame",
+	"UploadInstances",
+	"UploadClipRects",
+	"UploadNineSliceBorders",
+	"DrawSprites",
+	"BeginLayer",
+	"EndLayer",
+	"DrawLayer",
+	"BeginRegion",
+	"EndRegion",
+	"EndFrame"
+};
+
+/*** Global Variables ***/
+static bool bInitialized = false;
+static bool bInFrame = false;
+static uint32_t MaxInstanceCount = 0;
+static uint32_t UploadedInstanceCount = 0; // ̹ ӿ ø νϽ Դϴ.   ȿ ׸  ֽϴ.
+static uint32_t UploadedClipRectCount = 0; // ̹ ӿ ø Ŭ 簢 Դϴ. νϽ ׺  ȣ   ֽϴ.
+static uint32_t UploadedNineSliceBorderCount = 0;
+static size_t TextureArrayDataSize = 0;
+static uint32_t CurrentLayer = CACHED_LAYER_COUNT; // CACHED_LAYER_COUNT̸ ȭ鿡 ׸ Դϴ.
+static bool bLayersDrawn[CACHED_LAYER_COUNT] = {};
+static bool bInRegion = false;
+
+static NullRenderBackendStats Stats = {};
+static std::vector<NullRenderBackendCall> FrameCalls;
+static std::vector<NullRenderBackendCall> LastFrameCalls;
+
+/*** Global Functions ***/
+static void Initialize(uint32_t maxInstanceCount);
+static void Shutdown();
+static bool IsAstcSupported();
+static void CreateTextureArray(uint32_t format, uint32_t width, uint32_t height, uint32_t layerCount);
+static void UploadTextureArrayData(size_t dataOffset, const uint8_t* data, size_t dataSize);
+static void BeginFrame(bool bPreserveContents);
+static void UploadInstances(const glm::mat4* projectionViewWorlds, const glm::uvec4* textureAttributes, const glm::uvec4* spriteStyles, uint32_t instanceCount);
+static void UploadClipRects(const ScreenRect* rects, uint32_t rectCount);
+static void UploadNineSliceBorders(const NineSliceBorder* borders, uint32_t borderCount);
+static void DrawSprites(const SpriteDrawState& drawState, uint32_t firstInstance, uint32_t instanceCount);
+static void BeginLayer(uint32_t layer);
+static void EndLayer();
+static void DrawLayer(uint32_t layer);
+static void BeginRegion(const ScreenRect& rect);
+static void EndRegion();
+static void EndFrame();
+static void PrintStats(FILE* stream);
+
+static void RecordCall(NullRenderBackendCallType type, uint64_t argument0, uint64_t argument1);
+static void Validate(bool bValid, const char* message);
+
+static const RenderBackend NULL_RENDER_BACKEND =
+{
+	"Null",
+	Initialize,
+	Shutdown,
+	IsAstcSupported,
+	CreateTextureArray,
+	UploadTextureArrayData,
+	BeginFrame,
+	UploadInstances,
+	UploadClipRects,
+	UploadNineSliceBorders,
+	DrawSprites,
+	BeginLayer,
+	EndLayer,
+	DrawLayer,
+	BeginRegion,
+	EndRegion,
+	EndFrame,
+	PrintStats
+};
+
+const RenderBackend& GetNullRenderBackend()
+{
+	return NULL_RENDER_BACKEND;
+}
+
+const NullRenderBackendStats& GetNullRenderBackendStats()
+{
+	return Stats;
+}
+
+const std::vector<NullRenderBackendCall>& GetNullRenderBackendFrameCalls()
+{
+	return LastFrameCalls;
+}
+
+void Initialize(uint32_t maxInstanceCount)
+{
+	Validate(bInitialized == false, "Initialize called twice");
+
+	bInitialized = true;
+	MaxInstanceCount = maxInstanceCount;
+	Stats = {};
+
+	// GL 鿣 PVW , ؽó Ӽ , Ÿ , Ŭ 簢 ׵θ ۸ ģ ũԴϴ.
+	TrackGpuMemoryAllocation(GPU_MEMORY_INSTANCE_BUFFER, INSTANCE_BUFFER_NAME, INSTANCE_SIZE * maxInstanceCount + CLIP_RECT_TABLE_SIZE + NINE_SLICE_BORDER_TABLE_SIZE);
+}
+
+void Shutdown()
+{
+	Validate(bInitialized, "Shutdown called before Initialize");
+	Validate(bInFrame == false, "Shutdown called inside a frame");
+
+	TrackGpuMemoryRelease(GPU_MEMORY_INSTANCE_BUFFER, INSTANCE_BUFFER_NAME);
+	TrackGpuMemoryRelease(GPU_MEMORY_TEXTURE_ARRAY, TEXTURE_ARRAY_NAME);
+
+	for (uint32_t i = 0; i < CACHED_LAYER_COUNT; ++i)
+	{
+		if (bLayersDrawn[i])
+		{
+			TrackGpuMemoryRelease(GPU_MEMORY_RENDER_TARGET, LAYER_TARGET_NAME + i);
+			bLayersDrawn[i] = false;
+		}
+	}
+
+	TrackGpuMemoryRelease(GPU_MEMORY_RENDER_TARGET, LAYER_DEPTH_BUFFER_NAME);
+
+	bInitialized = false;
+	TextureArrayDataSize = 0;
+}
+
+bool IsAstcSupported()
+{
+	// ȯ ʴ  ε ð ª ͵  ״̹Ƿ Ѵٰ ϴ.
+	return true;
+}
+
+void CreateTextureArray(uint32_t format, uint32_t width, uint32_t height, uint32_t layerCount)
+{
+	Validate(bInitialized, "CreateTextureArray called before Initialize");
+	Validate(width % 4 == 0 && height % 4 == 0 && layerCount > 0, "CreateTextureArray size must be a non-empty multiple of the block size");
+
+	RecordCall(NULL_RENDER_CALL_CREATE_TEXTURE_ARRAY, format, static_cast<uint64_t>(width) * height * layerCount);
+
+	TextureArrayDataSize = static_cast<size_t>(width) * height * layerCount;
+	TrackGpuMemoryAllocation(GPU_MEMORY_TEXTURE_ARRAY, TEXTURE_ARRAY_NAME, TextureArrayDataSize);
+}
+
+void UploadTextureArrayData(size_t dataOffset, const uint8_t* data, size_t dataSize)
+{
+	Validate(TextureArrayDataSize > 0, "UploadTextureArrayData called before CreateTextureArray");
+	Validate(data != nullptr, "UploadTextureArrayData data must not be null");
+	Validate(dataOffset % BLOCK_SIZE == 0 && dataSize % BLOCK_SIZE == 0, "UploadTextureArrayData range must be block aligned");
+	Validate(dataOffset + dataSize <= TextureArrayDataSize, "UploadTextureArrayData range is outside the texture array");
+
+	RecordCall(NULL_RENDER_CALL_UPLOAD_TEXTURE_ARRAY_DATA, dataOffset, dataSize);
+
+	Stats.TextureUploadBytes += dataSize;
+}
+
+void BeginFrame(bool bPreserveContents)
+{
+	Validate(bInitialized, "BeginFrame called before Initialize");
+	Validate(bInFrame == false, "BeginFrame called twice");
+	Validate(bPreserveContents == false || Stats.FrameCount > 0, "BeginFrame cannot preserve the contents of the first frame");
+
+	bInFrame = true;
+	UploadedInstanceCount = 0;
+	UploadedClipRectCount = 0;
+	UploadedNineSliceBorderCount = 0;
+	FrameCalls.clear();
+
+	RecordCall(NULL_RENDER_CALL_BEGIN_FRAME, bPreserveContents ? 1 : 0, 0);
+
+	if (bPreserveContents)
+	{
+		++Stats.PreservedFrameCount;
+	}
+}
+
+void UploadInstances(const glm::mat4* projectionViewWorlds, const glm::uvec4* textureAttributes, const glm::uvec4* spriteStyles, uint32_t instanceCount)
+{
+	Validate(bInFrame, "UploadInstances called outside a frame");
+	Validate(projectionViewWorlds != nullptr && textureAttributes != nullptr && spriteStyles != nullptr, "UploadInstances data must not be null");
+	Validate(instanceCount <= MaxInstanceCount, "UploadInstances exceeds the instance buffer");
+
+	RecordCall(NULL_RENDER_CALL_UPLOAD_INSTANCES, instanceCount, 0);
+
+	// Ŭ 簢 ׵θ νϽ  ÷ ̴ ø    ʽϴ.
+	if (spriteStyles != nullptr)
+	{
+		bool bClipRectsValid = true;
+		bool bNineSliceBordersValid = true;
+
+		for (uint32_t i = 0; i < instanceCount; ++i)
+		{
+			const uint32_t clipRect = GetSpriteStyleClipRect(spriteStyles[i]);
+			const uint32_t border = GetSpriteStyleNineSliceBorder(spriteStyles[i]);
+			bClipRectsValid = bClipRectsValid && (clipRect == 0 || clipRect < UploadedClipRectCount);
+			bNineSliceBordersValid = bNineSliceBordersValid && (border == 0 || border < UploadedNineSliceBorderCount);
+		}
+
+		Validate(bClipRectsValid, "UploadInstances references clip rects that were not uploaded");
+		Validate(bNineSliceBordersValid, "UploadInstances references nine-slice borders that were not uploaded");
+	}
+
+	UploadedInstanceCount = instanceCount;
+	Stats.InstanceUploadBytes += INSTANCE_SIZE * instanceCount;
+}
+
+void UploadClipRects(const ScreenRect* rects, uint32_t rectCount)
+{
+	Validate(bInFrame, "UploadClipRects called outside a frame");
+	Validate(rects != nullptr, "UploadClipRects data must not be null");
+	Validate(rectCount <= MAX_CLIP_RECT_COUNT, "UploadClipRects exceeds the clip rect table");
+
+	RecordCall(NULL_RENDER_CALL_UPLOAD_CLIP_RECTS, rectCount, 0);
+
+	UploadedClipRectCount = rectCount;
+	Stats.InstanceUploadBytes += sizeof(glm::vec4) * rectCount;
+}
+
+void UploadNineSliceBorders(const NineSliceBorder* borders, uint32_t borderCount)
+{
+	Validate(bInFrame, "UploadNineSliceBorders called outside a frame");
+	Validate(borders != nullptr, "UploadNineSliceBorders data must not be null");
+	Validate(borderCount <= MAX_NINE_SLICE_BORDER_COUNT, "UploadNineSliceBorders exceeds the border table");
+
+	RecordCall(NULL_RENDER_CALL_UPLOAD_NINE_SLICE_BORDERS, borderCount, 0);
+
+	UploadedNineSliceBorderCount = borderCount;
+	Stats.InstanceUploadBytes += sizeof(glm::vec4) * borderCount;
+}
+
+void DrawSprites(const SpriteDrawState& drawState, uint32_t firstInstance, uint32_t instanceCount)
+{
+	Validate(bInFrame, "DrawSprites called outside a frame");
+	Validate(TextureArrayDataSize > 0, "DrawSprites called without a texture array");
+	Validate(drawState.Pass < SPRITE_BLEND_MODE_COUNT, "DrawSprites pass is invalid");
+	Validate(drawState.bPointSprites == false || drawState.Pass == SPRITE_BLEND_OPAQUE, "DrawSprites point sprites must be drawn in the opaque pass");
+	Validate(instanceCount > 0, "DrawSprites called with no instances");
+	Validate(static_cast<uint64_t>(firstInstance) + instanceCount <= UploadedInstanceCount, "DrawSprites reads instances that were not uploaded");
+
+	RecordCall(NULL_RENDER_CALL_DRAW_SPRITES, firstInstance, instanceCount);
+	FrameCalls.back().DrawState = drawState;
+
+	++Stats.DrawCallCount;
+	Stats.DrawnInstanceCount += instanceCount;
+
+	if (drawState.bPointSprites)
+	{
+		Stats.PointSpriteInstanceCount += instanceCount;
+	}
+
+	if (CurrentLayer < CACHED_LAYER_COUNT)
+	{
+		++Stats.LayerDrawCallCount;
+	}
+}
+
+void BeginLayer(uint32_t layer)
+{
+	Validate(bInFrame, "BeginLayer called outside a frame");
+	Validate(CurrentLayer == CACHED_LAYER_COUNT, "BeginLayer called inside another layer");
+	Validate(bInRegion == false, "BeginLayer called inside a region");
+	Validate(layer < CACHED_LAYER_COUNT, "BeginLayer layer is invalid");
+
+	RecordCall(NULL_RENDER_CALL_BEGIN_LAYER, layer, 0);
+
+	if (layer >= CACHED_LAYER_COUNT)
+	{
+		return;
+	}
+
+	// GL 鿣 ó ׸  RGBA8  ؽó ,  ۴  ̾ Բ ϴ.
+	if (bLayersDrawn[layer] == false)
+	{
+		TrackGpuMemoryAllocation(GPU_MEMORY_RENDER_TARGET, LAYER_TARGET_NAME + layer, 4 * RENDER_TARGET_WIDTH * RENDER_TARGET_HEIGHT);
+		TrackGpuMemoryAllocation(GPU_MEMORY_RENDER_TARGET, LAYER_DEPTH_BUFFER_NAME, 4 * RENDER_TARGET_WIDTH * RENDER_TARGET_HEIGHT);
+		bLayersDrawn[layer] = true;
+	}
+
+	CurrentLayer = layer;
+}
+
+void EndLayer()
+{
+	Validate(CurrentLayer < CACHED_LAYER_COUNT, "EndLayer called without BeginLayer");
+
+	RecordCall(NULL_RENDER_CALL_END_LAYER, CurrentLayer, 0);
+
+	CurrentLayer = CACHED_LAYER_COUNT;
+}
+
+void DrawLayer(uint32_t layer)
+{
+	Validate(bInFrame, "DrawLayer called outside a frame");
+	Validate(CurrentLayer == CACHED_LAYER_COUNT, "DrawLayer called inside a layer");
+	Validate(layer < CACHED_LAYER_COUNT && bLayersDrawn[layer], "DrawLayer layer was never drawn");
+
+	RecordCall(NULL_RENDER_CALL_DRAW_LAYER, layer, 0);
+}
+
+void BeginRegion(const ScreenRect& rect)
+{
+	Validate(bInFrame, "BeginRegion called outside a frame");
+	Validate(bInRegion == false, "BeginRegion called inside another region");
+	Validate(CurrentLayer == CACHED_LAYER_COUNT, "BeginRegion called inside a layer");
+	Validate(rect.X >= 0 && rect.Y >= 0 && rect.Width > 0 && rect.Height > 0
+		&& rect.X + rect.Width <= RENDER_TARGET_WIDTH && rect.Y + rect.Height <= RENDER_TARGET_HEIGHT, "BeginRegion rect is outside the render target");
+
+	//  ϳ X, Y, ٸ ϳ ũ⸦ ϴ.
+	RecordCall(NULL_RENDER_CALL_BEGIN_REGION
+		, static_cast<uint64_t>(static_cast<uint32_t>(rect.X)) << 32 | static_cast<uint32_t>(rect.Y)
+		, static_cast<uint64_t>(static_cast<uint32_t>(rect.Width)) << 32 | static_cast<uint32_t>(rect.Height));
+
+	bInRegion = true;
+	Stats.RegionPixelCount += static_cast<uint64_t>(rect.Width) * rect.Height;
+}
+
+void EndRegion()
+{
+	Validate(bInRegion, "EndRegion called without BeginRegion");
+
+	RecordCall(NULL_RENDER_CALL_END_REGION, 0, 0);
+
+	bInRegion = false;
+}
+
+void EndFrame()
+{
+	Validate(bInFrame, "EndFrame called outside a frame");
+	Validate(CurrentLayer == CACHED_LAYER_COUNT, "EndFrame called inside a layer");
+	Validate(bInRegion == false, "EndFrame called inside a region");
+
+	RecordCall(NULL_RENDER_CALL_END_FRAME, 0, 0);
+
+	bInFrame = false;
+	++Stats.FrameCount;
+
+	LastFrameCalls.swap(FrameCalls);
+}
+
+void PrintStats(FILE* stream)
+{
+	assert(stream != nullptr);
+
+	const double frameCount = Stats.FrameCount > 0 ? static_cast<double>(Stats.FrameCount) : 1.0;
+
+	fprintf(stream, "Null backend: %llu frames, %.1f draws/frame (%.1f into layers), %.1f instances/frame (%.1f as points), %.1f KB instance uploads/frame, %.1f KB texture uploads, %llu preserved frames (%.1f%% of pixels redrawn), %llu validation errors\n"
+		, static_cast<unsigned long long>(Stats.FrameCount)
+		, Stats.DrawCallCount / frameCount
+		, Stats.LayerDrawCallCount / frameCount
+		, Stats.DrawnInstanceCount / frameCount
+		, Stats.PointSpriteInstanceCount / frameCount
+		, Stats.InstanceUploadBytes / frameCount / 1024.0
+		, Stats.TextureUploadBytes / 1024.0
+		, static_cast<unsigned long long>(Stats.PreservedFrameCount)
+		, Stats.PreservedFrameCount > 0 ? 100.0 * Stats.RegionPixelCount / (Stats.PreservedFrameCount * static_cast<double>(RENDER_TARGET_WIDTH * RENDER_TARGET_HEIGHT)) : 0.0
+		, static_cast<unsigned long long>(Stats.ValidationErrorCount));
+
+	for (int i = 0; i < NULL_RENDER_CALL_TYPE_COUNT; ++i)
+	{
+		fprintf(stream, "  %-24s %llu\n", CALL_NAMES[i], static_cast<unsigned long long>(Stats.CallCounts[i]));
+	}
+}
+
+void RecordCall(NullRenderBackendCallType type, uint64_t argument0, uint64_t argument1)
+{
+	++Stats.CallCounts[type];
+
+	// ؽó εó  ۿ Ͼ ȣ 迡 ϴ.
+	if (bInFrame)
+	{
+		FrameCalls.push_back({ type, { argument0, argument1 }, {} });
+	}
+}
+
+void Validate(bool bValid, const char* message)
+{
+	if (bValid == false)
+	{
+		fprintf(stderr, "Null backend: %s\n", message);
+		++Stats.ValidationErrorCount;
+	}
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+/*
+	ƹ͵ ׸ ʰ ȣ ˻ϰ ϸ ϴ  鿣Դϴ.
+	÷̿ GPU   CI,      ü ϴ  մϴ.
+
+	 Ʋ ȣ̳   ε, ׸  ϰ  ϴ.
+	 Ҵ GpuMemory ϵǹǷ  ޸ 赵 GL 鿣  ɴϴ.
+*/
+
+#include <cstdint>
+#include <vector>
+
+#include "RenderBackend.h"
+
+enum NullRenderBackendCallType
+{
+	NULL_RENDER_CALL_CREATE_TEXTURE_ARRAY,
+	NULL_RENDER_CALL_UPLOAD_TEXTURE_ARRAY_DATA,
+	NULL_RENDER_CALL_BEGIN_FRAME,
+	NULL_RENDER_CALL_UPLOAD_INSTANCES,
+	NULL_RENDER_CALL_UPLOAD_CLIP_RECTS,
+	NULL_RENDER_CALL_UPLOAD_NINE_SLICE_BORDERS,
+	NULL_RENDER_CALL_DRAW_SPRITES,
+	NULL_RENDER_CALL_BEGIN_LAYER,
+	NULL_RENDER_CALL_END_LAYER,
+	NULL_RENDER_CALL_DRAW_LAYER,
+	NULL_RENDER_CALL_BEGIN_REGION,
+	NULL_RENDER_CALL_END_REGION,
+	NULL_RENDER_CALL_END_FRAME,
+	NULL_RENDER_CALL_TYPE_COUNT
+};
+
+// ϵ ȣ ϳԴϴ.  ǹ̴ ȣ⸶ ٸϴ(° ũ, ù νϽ  ).
+struct NullRenderBackendCall
+{
+	NullRenderBackendCallType Type;
+	uint64_t Arguments[2];
+	SpriteDrawState DrawState; // NULL_RENDER_CALL_DRAW_SPRITES  մϴ.
+};
+
+struct NullRenderBackendStats
+{
+	uint64_t CallCounts[NULL_RENDER_CALL_TYPE_COUNT];
+	uint64_t FrameCount;
+	uint64_t DrawCallCount;
+	uint64_t DrawnInstanceCount;
+	uint64_t PointSpriteInstanceCount; //  ׸ νϽ Դϴ. DrawnInstanceCount Ե˴ϴ.
+	uint64_t LayerDrawCallCount; // ĳ ̾ ׸ DrawSprites Դϴ. DrawCallCount Ե˴ϴ.
+	uint64_t PreservedFrameCount; // ȭ ϰ ٲ  ٽ ׸  Դϴ.
+	uint64_t RegionPixelCount; // BeginRegion  ȼ Դϴ.
+	uint64_t InstanceUploadBytes;
+	uint64_t TextureUploadBytes;
+	uint64_t ValidationErrorCount;
+};
+
+const RenderBackend& GetNullRenderBackend();
+
+const NullRenderBackendStats& GetNullRenderBackendStats();
+
+//   (BeginFrame EndFrame) ȣ Դϴ. ׽Ʈ     մϴ.
+const std::vector<NullRenderBackendCall>& GetNullRenderBackendFrameCalls();
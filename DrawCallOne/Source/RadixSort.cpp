@@ -0,0 +1,159 @@
+#include "RadixSort.h"
+
+#include <cassert>
+#include <cstring>
+#include <vector>
+#include <algorithm>
+
+#include "JobPool.h"
+
+/*** Constant Variables ***/
+// ڸ  ȴ Ƚ پϴ. 11Ʈ  ׷ 16KB L1 ĳÿ ϴ.
+static constexpr int RADIX_BIT_COUNT = 11;
+static constexpr size_t RADIX_BUCKET_COUNT = 1 << RADIX_BIT_COUNT;
+
+// ۾ 带  ٸ  Ƿ ׸    մϴ.
+static constexpr size_t PARALLEL_ITEM_COUNT = 32 * 1024;
+static constexpr size_t MIN_ITEM_COUNT_PER_CHUNK = 16 * 1024;
+
+/*** Global Variables ***/
+static std::vector<size_t> Histograms; //  ڸ   ϳ ϴ.
+static std::vector<size_t> Offsets; //  ڸ    ġ ϳ ϴ.
+static std::vector<uint64_t> ChunkChangedBits; //  ù ׸ Ű  ٸ Ʈ ϴ.
+
+void RadixSort(RadixSortItem* items, RadixSortItem* scratch, size_t count, int keyBitCount)
+{
+	assert(items != nullptr && scratch != nullptr);
+	assert(keyBitCount > 0 && keyBitCount <= 64);
+
+	if (count <= 1)
+	{
+		return;
+	}
+
+	size_t chunkCount = 1;
+
+	if (count >= PARALLEL_ITEM_COUNT)
+	{
+		chunkCount = std::min<size_t>(GetJobThreadCount(), count / MIN_ITEM_COUNT_PER_CHUNK);
+	}
+
+	const size_t chunkSize = (count + chunkCount - 1) / chunkCount;
+
+	Histograms.resize(chunkCount * RADIX_BUCKET_COUNT);
+	Offsets.resize(chunkCount * RADIX_BUCKET_COUNT);
+	ChunkChangedBits.resize(chunkCount);
+
+	//  Ű    Ʈ   Ƿ  ٲ Ʈ ڸ ϴ.
+	RunJobs(static_cast<uint32_t>(chunkCount), [&](uint32_t chunk)
+	{
+		const size_t chunkBegin = std::min(chunk * chunkSize, count);
+		const size_t chunkEnd = std::min(chunkBegin + chunkSize, count);
+		uint64_t changedBits = 0;
+
+		for (size_t i = chunkBegin; i < chunkEnd; ++i)
+		{
+			changedBits |= items[i].Key ^ items[0].Key;
+		}
+
+		ChunkChangedBits[chunk] = changedBits;
+	});
+
+	uint64_t changedBits = 0;
+
+	for (uint64_t chunkChangedBits : ChunkChangedBits)
+	{
+		changedBits |= chunkChangedBits;
+	}
+
+	if (keyBitCount < 64)
+	{
+		changedBits &= (1ull << keyBitCount) - 1;
+	}
+
+	RadixSortItem* source = items;
+	RadixSortItem* destination = scratch;
+
+	/*
+		ڸ  ܰ óմϴ. 1 3   ۾  Ǯ óմϴ.
+		1.  ڸ   ϴ.
+		2.  ڸ  ü  ڸ        ġ մϴ.
+		3.  ׸  ġ űϴ.
+		ڸ      ٲ Ʈ ϹǷ   Ʈ  ʽϴ.
+	*/
+	while (changedBits != 0)
+	{
+		int shift = 0;
+
+		while (((changedBits >> shift) & 1) == 0)
+		{
+			++shift;
+		}
+
+		changedBits = shift + RADIX_BIT_COUNT < 64 ? changedBits & (~0ull << (shift + RADIX_BIT_COUNT)) : 0;
+
+		RunJobs(static_cast<uint32_t>(chunkCount), [&](uint32_t chunk)
+		{
+			const size_t chunkBegin = std::min(chunk * chunkSize, count);
+			const size_t chunkEnd = std::min(chunkBegin + chunkSize, count);
+			size_t* histogram = Histograms.data() + chunk * RADIX_BUCKET_COUNT;
+
+			std::fill(histogram, histogram + RADIX_BUCKET_COUNT, 0);
+
+			for (size_t i = chunkBegin; i < chunkEnd; ++i)
+			{
+				++histogram[(source[i].Key >> shift) & (RADIX_BUCKET_COUNT - 1)];
+			}
+		});
+
+		size_t offset = 0;
+
+		for (size_t bucket = 0; bucket < RADIX_BUCKET_COUNT; ++bucket)
+		{
+			size_t bucketCount = 0;
+
+			for (size_t chunk = 0; chunk < chunkCount; ++chunk)
+			{
+				Offsets[chunk * RADIX_BUCKET_COUNT + bucket] = offset + bucketCount;
+				bucketCount += Histograms[chunk * RADIX_BUCKET_COUNT + bucket];
+			}
+
+			offset += bucketCount;
+		}
+
+		RunJobs(static_cast<uint32_t>(chunkCount), [&](uint32_t chunk)
+		{
+			const size_t chunkBegin = std::min(chunk * chunkSize, count);
+			const size_t chunkEnd = std::min(chunkBegin + chunkSize, count);
+			size_t* offsets = Offsets.data() + chunk * RADIX_BUCKET_COUNT;
+
+			for (size_t i = chunkBegin; i < chunkEnd; ++i)
+			{
+				destination[offsets[(source[i].Key >> shift) & (RADIX_BUCKET_COUNT - 1)]++] = source[i];
+			}
+		});
+
+		std::swap(source, destination);
+	}
+
+	//  scratch  items մϴ.
+	if (source != items)
+	{
+		RunJobs(static_cast<uint32_t>(chunkCount), [&](uint32_t chunk)
+		{
+			const size_t chunkBegin = std::min(chunk * chunkSize, count);
+			const size_t chunkEnd = std::min(chunkBegin + chunkSize, count);
+
+			std::copy(source + chunkBegin, source + chunkEnd, items + chunkBegin);
+		});
+	}
+}
+
+uint32_t GetSortableFloatBits(float value)
+{
+	uint32_t bits = 0;
+	memcpy(&bits, &value, sizeof(bits));
+
+	//   Ʈ,  ȣ Ʈ     float   ϴ.
+	return (bits & 0x80000000u) != 0 ? ~bits : bits | 0x80000000u;
+}
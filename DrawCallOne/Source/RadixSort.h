@@ -0,0 +1,27 @@
+#pragma once
+
+/*
+	Ű  ׸ ϴ LSD( ڸ)  Դϴ.
+	11Ʈ  ڸ   ȱ   İ ޸ ׸  ϴ ð ɸϴ.
+	׸    ۾  Ǯ(JobPool.h) ׷ ġ ÿ óմϴ.
+	 ׷  ιǷ RadixSort    忡 ȣؾ մϴ.
+
+	 Ű   ˴ϴ. ( )
+	 Ű    Ʈ ǳʶٹǷ    ʵ   Ʈŭ Ƚϴ.
+*/
+
+#include <cstdint>
+#include <cstddef>
+
+struct RadixSortItem
+{
+	uint64_t Key;
+	uint32_t Value; //   ȣԴϴ.
+};
+
+// items Key  մϴ. scratch items  ũ⿩ ϸ  ϴ.
+// keyBitCount Ŀ ϴ Ʒ Ʈ Դϴ. (1~64)   Ʈ    ʰ ׸ Բ Űϴ.
+void RadixSort(RadixSortItem* items, RadixSortItem* scratch, size_t count, int keyBitCount);
+
+// float  ũ   ȣ   ٲߴϴ.  Ű   մϴ.
+uint32_t GetSortableFloatBits(float value);
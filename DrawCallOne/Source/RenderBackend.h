@@ -0,0 +1,125 @@
+#pragma once
+
+/*
+	Ʈ  ׷ API ûϴ  Ƶ  鿣 ̽Դϴ.
+	ùķ̼, ؽó δ,  Ŷ 鿣带 ؼ ׸⸦ ûϹǷ GPU  ȯ濡 ״ ˴ϴ.
+
+	Լ   ؽƮ  忡 ȣؾ ˴ϴ.
+	  BeginFrame, UploadClipRects, UploadNineSliceBorders, UploadInstances, DrawSprites( ), EndFrame  ȣմϴ.
+
+	 ٲ ʴ Ʈ ĳ ̾   ׷ΰ  ӿ ռ   ֽϴ.
+	BeginLayer EndLayer  DrawSprites ȭ  ̾ ׷, ̾  ٽ ׸   ٲ ˴ϴ.
+	DrawLayer ̾ ȭ  Ƽö̵ ķ  ׸ ̴ ˻ϰų  ʽϴ.
+
+	ָ ־  ȼۿ  ʴ Ʈ SpriteDrawState bPointSprites 簢   ׸  ֽϴ.
+	 ؽó  ʰ νϽ  äǷ Ʈ    óϰ ؼ д  ϴ(SpriteStyle.h).
+
+	BeginFrame ȭ ϵ ûϸ    ״  ֽϴ.
+	ٲ  BeginRegion     ģ Ʈ ٽ ׸  ȼ ٽ ĥ ʽϴ.
+*/
+
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+
+#include <glm/glm.hpp>
+
+static constexpr uint32_t CACHED_LAYER_COUNT = 2;
+
+// νϽ   ִ Ŭ 簢 Դϴ. 0 ڸ ʴ´ٴ ̹Ƿ  ʽϴ.
+static constexpr uint32_t MAX_CLIP_RECT_COUNT = 256;
+
+// νϽ   ִ  ̽ ׵θ Դϴ. 0 ׵θ ٴ ̹Ƿ  ʽϴ.
+static constexpr uint32_t MAX_NINE_SLICE_BORDER_COUNT = 64;
+
+enum SpriteBlendMode
+{
+	SPRITE_BLEND_OPAQUE, //  ؼ մϴ.
+	SPRITE_BLEND_ALPHA_TEST, // ؼ  ϰų մϴ.
+	SPRITE_BLEND_TRANSLUCENT, //  ؼ ֽϴ.
+	SPRITE_BLEND_MODE_COUNT
+};
+
+enum MaterialBlendMode
+{
+	MATERIAL_BLEND_ALPHA, // ؽó Ŀ  ,  ׽Ʈ,  н ϴ.
+	MATERIAL_BLEND_ADDITIVE, // , Ҳ  ȿ  մϴ.
+};
+
+// ȭ ȼ  簢Դϴ. GL   Ʒ Դϴ.
+struct ScreenRect
+{
+	int32_t X;
+	int32_t Y;
+	int32_t Width;
+	int32_t Height;
+};
+
+//  ̽ Ʈ ׵θ βԴϴ. ؼ ̸ ũ⸦ ٲ㵵 ׵θ þ ʽϴ.
+struct NineSliceBorder
+{
+	uint16_t Left;
+	uint16_t Right;
+	uint16_t Bottom;
+	uint16_t Top;
+};
+
+//  · ׸ νϽ  ϳ Դϴ. Ƽ нκ ϴ.
+struct SpriteDrawState
+{
+	uint16_t MaterialID;
+	SpriteBlendMode Pass; //  н  ׽Ʈ  ʰ,  н  ̸  ʽϴ.
+	MaterialBlendMode BlendMode;
+	bool bDepthTest;
+	glm::vec4 Tint;
+	bool bPointSprites; // νϽ  ϳ ׸ϴ.  ׽Ʈ  Ƿ  н ǰ Ŭ 簢   ϴ.
+};
+
+struct RenderBackend
+{
+	const char* Name;
+
+	// ׸⿡ ʿ ü(, νϽ , ̴ ) ϴ.  ӿ maxInstanceCount ׸  ֽϴ.
+	void (*Initialize)(uint32_t maxInstanceCount);
+	void (*Shutdown)();
+
+	// ASTC 4x4 ؽó ȯ ʰ   ִ Ȯմϴ.
+	bool (*IsAstcSupported)();
+
+	// ؽó ̸ ϴ. ̹    ϴ. format GL  ̸   4x4  ϳ 16ƮԴϴ.
+	void (*CreateTextureArray)(uint32_t format, uint32_t width, uint32_t height, uint32_t layerCount);
+
+	//  ٷ ̾ ؽó   Ϻθ øϴ. ° ũ 16Ʈ  Դϴ.
+	void (*UploadTextureArrayData)(size_t dataOffset, const uint8_t* data, size_t dataSize);
+
+	// bPreserveContents false̸ ȭ ü , true̸     ׸ϴ.
+	void (*BeginFrame)(bool bPreserveContents);
+
+	// νϽ ġ ũ(ProjectionViewWorld), ؽó Ӽ, ȸ, , ũ   (SpriteStyle.h) øϴ.
+	void (*UploadInstances)(const glm::mat4* projectionViewWorlds, const glm::uvec4* textureAttributes, const glm::uvec4* spriteStyles, uint32_t instanceCount);
+
+	// νϽ SpriteStyle Ŭ ȣ ϴ 簢 ǥ øϴ. rects[0]   rectCount MAX_CLIP_RECT_COUNT Դϴ.
+	// ũ 丶 ׸⸦  ʵ ̴ νϽ ߶ ׸ϴ. ׸    ø    ˴ϴ.
+	void (*UploadClipRects)(const ScreenRect* rects, uint32_t rectCount);
+
+	// νϽ SpriteStyle ׵θ ȣ ϴ  ̽ ׵θ ǥ øϴ. borders[0]   borderCount MAX_NINE_SLICE_BORDER_COUNT Դϴ.
+	// гθ Ʈ ȩ  ׸ ʵ ̴ νϽ ϳ ؽó ǥ  ϴ. Ŭ 簢  ׸    øϴ.
+	void (*UploadNineSliceBorders)(const NineSliceBorder* borders, uint32_t borderCount);
+	void (*DrawSprites)(const SpriteDrawState& drawState, uint32_t firstInstance, uint32_t instanceCount);
+
+	// ĳ ̾ ϰ   DrawSprites  ̾ ׸ϴ. layer CACHED_LAYER_COUNT ۾ƾ ˴ϴ.
+	void (*BeginLayer)(uint32_t layer);
+	void (*EndLayer)();
+
+	//   ̻ ׸ ĳ ̾ ȭ鿡 ռմϴ.
+	void (*DrawLayer)(uint32_t layer);
+
+	//   EndRegion ׸⸦   մϴ. ĳ ̾ ׸ ߿   ϴ.
+	void (*BeginRegion)(const ScreenRect& rect);
+	void (*EndRegion)();
+
+	void (*EndFrame)();
+
+	// 鿣庰 (ȣ , ۷ ) մϴ.
+	void (*PrintStats)(FILE* stream);
+};
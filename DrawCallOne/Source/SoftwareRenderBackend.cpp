@@ -0,0 +1,1409 @@
+#include "SoftwareRenderBackend.h"
+
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+#include "AstcDecoder.h"
+#include "JobPool.h"
+#include "SpriteStyle.h"
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__SSE2__)
+	#include <emmintrin.h>
+	#define SOFTWARE_RENDER_USE_SSE2
+#endif
+
+/*** Structures ***/
+enum SoftwareDrawType
+{
+	SOFTWARE_DRAW_SPRITES,
+	SOFTWARE_DRAW_LAYER, // ĳ ̾ ռմϴ.
+	SOFTWARE_DRAW_CLEAR, // BeginRegion  ϴ.
+};
+
+struct SoftwareDraw
+{
+	SoftwareDrawType Type;
+	SpriteDrawState State;
+	uint32_t FirstInstance;
+	uint32_t InstanceCount;
+	uint32_t Layer;
+	int32_t ClipMinX, ClipMinY, ClipMaxX, ClipMaxY; // ׸  ִ ȼ Դϴ. Max  ʽϴ.
+};
+
+// ׸   Ʈ ϳԴϴ.  νϽ   ׷  ֽϴ.
+struct SpriteReference
+{
+	uint32_t Instance;
+	uint32_t Draw;
+};
+
+/*
+	ŸϿ     صδ Ʈ Դϴ.
+	ȭ ǥ(ȼ ߽) ؽó ǥ ̷  1 Լ  ϹǷ ٸ       ֽϴ.
+*/
+struct SoftwareSprite
+{
+	float S0, DsDx, DsDy; // Ʈ  ǥԴϴ. ̴ TexCoord.x ϴ.
+	float T0, DtDx, DtDy;
+	float CoordWidth; // Ʈ ǥ Դϴ. ũ⸦ ٲ ʾ ؽó ũԴϴ.
+	float CoordHeight;
+	bool bMapTexCoord; // ũ⸦ ٲų  ̸̽ Ʈ ǥ TexCoordMapping ؽó ǥ ٲߴϴ.
+	bool bPointSprite; // ؽó  ʰ Tint äϴ.
+	SpriteTexCoordMapping TexCoordMapping;
+	float Depth0, DepthDx, DepthDy; // 0~1   Դϴ.
+	float MinDepth; //   Դϴ.   ؼ  ۰ մϴ.
+
+	int32_t MinX, MinY, MaxX, MaxY; //  ȼ Դϴ. Max  ʽϴ.
+
+	uint32_t Width;
+	uint32_t Height;
+	uint32_t StartX;
+	uint32_t StartBand;
+	uint32_t RowPitch; // 4    ũԴϴ. ؽó 4   ϴ Դϴ.
+	glm::vec4 Tint; // νϽ Դϴ. Ƽ  Բ ϴ.
+
+	uint32_t Draw;
+};
+
+// ׸ ϳ  ٲ ʴ   Դϴ. GLES 鿣 ApplyMaterial  Ģ մϴ.
+struct SpriteRasterState
+{
+	bool bAlphaTest;
+	bool bBlend;
+	bool bAdditive;
+	bool bDepthTest;
+	bool bDepthWrite;
+	bool bUntinted;
+	float Tint[4];
+};
+
+/*** Constant Variables ***/
+static constexpr int32_t TILE_SIZE = 64; // Ÿ  (32KB) ھ ĳÿ  ũԴϴ.
+static constexpr int32_t DEPTH_BLOCK_SIZE = 8; //   ̸  ϴ  ũԴϴ. Ÿ ũ  ˴ϴ.
+static constexpr uint32_t ATLAS_WIDTH = 512; // ̴ 带 512 ؼ,    128 մϴ.
+static constexpr uint32_t ATLAS_HEIGHT = 512;
+static constexpr size_t BLOCK_SIZE = 16;
+static constexpr uint32_t ASTC_4x4_FORMAT = 0x93B0; // GL_COMPRESSED_RGBA_ASTC_4x4_KHR
+static constexpr size_t UPLOAD_JOB_BLOCK_COUNT = 4096;
+static constexpr float ALPHA_TEST_THRESHOLD = 0.05f;
+
+// GLES 鿣尡  (0.2, 0.3, 0.3, 1.0) RGBA8 ٲ Դϴ.
+static constexpr uint32_t CLEAR_COLOR = 51u | (77u << 8) | (77u << 16) | (255u << 24);
+static constexpr float CLEAR_DEPTH = 1.0f;
+
+/*** Global Variables ***/
+static bool bInitialized = false;
+static bool bInFrame = false;
+static bool bPreserveContents = false;
+static bool bInRegion = false;
+static ScreenRect CurrentRegion = {};
+
+static uint32_t TargetWidth = 0;
+static uint32_t TargetHeight = 0;
+static uint32_t TileCountX = 0;
+static uint32_t TileCountY = 0;
+static std::vector<uint32_t> ColorBuffer;
+static std::vector<float> DepthBuffer;
+static std::vector<uint32_t> LayerColorBuffers[CACHED_LAYER_COUNT]; // ó ׸  ϴ. Ƽö̵ Դϴ.
+static uint32_t* TargetColors = nullptr; //  ׸  Դϴ. ȭ̰ų ĳ ̾Դϴ.
+static uint32_t TargetClearColor = CLEAR_COLOR;
+static bool bClearTarget = true; // Ÿ ׸  ϴ. ȭ ϴ ӿ  ϴ.
+static uint32_t BlockCountX = 0;
+static std::vector<float> BlockMaxDepths; // 8x8 ϸ   Դϴ.
+
+static std::vector<uint32_t> AtlasTexels; // RGBA8 Ǯ ؽó Դϴ. , ,  Դϴ.
+
+static uint32_t MaxInstanceCount = 0;
+static uint32_t UploadedInstanceCount = 0;
+static std::vector<glm::mat4> InstanceTransforms;
+static std::vector<glm::uvec4> InstanceTextureAttributes;
+static std::vector<glm::uvec4> InstanceStyles;
+static ScreenRect ClipRects[MAX_CLIP_RECT_COUNT] = {}; // νϽ Ÿ Ŭ ȣ մϴ. 0  ʽϴ.
+static uint32_t ClipRectCount = 0;
+static NineSliceBorder NineSliceBorders[MAX_NINE_SLICE_BORDER_COUNT] = {}; // νϽ Ÿ ׵θ ȣ մϴ. 0  ʽϴ.
+static uint32_t NineSliceBorderCount = 0;
+
+static std::vector<SoftwareDraw> Draws;
+static std::vector<SpriteReference> SpriteReferences;
+static std::vector<SoftwareSprite> SetupSprites;
+
+// ĳ ̾ ׸  ȭ鿡 ׸  Űܵδ Դϴ.
+static uint32_t CurrentLayer = CACHED_LAYER_COUNT;
+static std::vector<SoftwareDraw> FrameDraws;
+static std::vector<SpriteReference> FrameSpriteReferences;
+
+// 帶  Ʈ   ϴ. Ÿ ׸     ׸  ˴ϴ.
+static uint32_t BinChunkCount = 0;
+static std::vector<std::vector<uint32_t>> TileBins; // [ * Ÿ  + Ÿ]
+
+static std::atomic<uint64_t> FrameBinnedSpriteCount;
+static std::atomic<uint64_t> FrameTileSpriteCount;
+static std::atomic<uint64_t> FrameShadedFragmentCount;
+static double FrameRasterTime = 0.0;
+
+static SoftwareRenderBackendStats Stats = {};
+
+/*** Global Functions ***/
+static void Initialize(uint32_t maxInstanceCount);
+static void Shutdown();
+static bool IsAstcSupported();
+static void CreateTextureArray(uint32_t format, uint32_t width, uint32_t height, uint32_t layerCount);
+static void UploadTextureArrayData(size_t dataOffset, const uint8_t* data, size_t dataSize);
+static void BeginFrame(bool bPreserve);
+static void UploadInstances(const glm::mat4* projectionViewWorlds, const glm::uvec4* textureAttributes, const glm::uvec4* spriteStyles, uint32_t instanceCount);
+static void UploadClipRects(const ScreenRect* rects, uint32_t rectCount);
+static void UploadNineSliceBorders(const NineSliceBorder* borders, uint32_t borderCount);
+static void DrawSprites(const SpriteDrawState& drawState, uint32_t firstInstance, uint32_t instanceCount);
+static void BeginLayer(uint32_t layer);
+static void EndLayer();
+static void DrawLayer(uint32_t layer);
+static void BeginRegion(const ScreenRect& rect);
+static void EndRegion();
+static void EndFrame();
+static void PrintStats(FILE* stream);
+
+static void DecodeAtlasBlocks(size_t firstBlock, const uint8_t* data, size_t blockCount);
+static bool SetupSprite(const SpriteReference& reference, SoftwareSprite* outSprite);
+static bool SetupPointSprite(const SpriteReference& reference, SoftwareSprite* outSprite);
+static void RecordDraw(SoftwareDrawType type, const SpriteDrawState& drawState, uint32_t firstInstance, uint32_t instanceCount, uint32_t layer);
+static void RasterizeDraws(uint32_t* colors, uint32_t clearColor, bool bClear);
+static void BinSprites(uint32_t chunk);
+static void RasterizeTile(uint32_t tile);
+static uint64_t CompositeLayer(uint32_t layer, int32_t minX, int32_t minY, int32_t maxX, int32_t maxY);
+static inline uint32_t BlendLayerPixel(uint32_t source, uint32_t destination);
+static void ClearRect(int32_t minX, int32_t minY, int32_t maxX, int32_t maxY);
+static uint64_t RasterizeSprite(const SoftwareSprite& sprite, int32_t tileMinX, int32_t tileMinY, int32_t tileMaxX, int32_t tileMaxY);
+static uint64_t RasterizeSpan(const SoftwareSprite& sprite, const SpriteRasterState& state, int32_t y, int32_t minX, int32_t maxX);
+static float GetBlockMaxDepth(int32_t blockMinX, int32_t blockMinY);
+static bool ClipSpan(float value, float step, float limit, int32_t* begin, int32_t* end);
+static inline uint32_t FetchAtlasTexel(const SoftwareSprite& sprite, float s, float t);
+static inline void ShadeFragment(const SpriteRasterState& state, uint32_t texel, float depth, uint32_t* color, float* depthValue);
+#if defined(SOFTWARE_RENDER_USE_SSE2)
+static inline uint32_t CountLaneMaskBits(int laneMask);
+#endif
+
+static const RenderBackend SOFTWARE_RENDER_BACKEND =
+{
+	"Software",
+	Initialize,
+	Shutdown,
+	IsAstcSupported,
+	CreateTextureArray,
+	UploadTextureArrayData,
+	BeginFrame,
+	UploadInstances,
+	UploadClipRects,
+	UploadNineSliceBorders,
+	DrawSprites,
+	BeginLayer,
+	EndLayer,
+	DrawLayer,
+	BeginRegion,
+	EndRegion,
+	EndFrame,
+	PrintStats
+};
+
+const RenderBackend& GetSoftwareRenderBackend()
+{
+	return SOFTWARE_RENDER_BACKEND;
+}
+
+void SetSoftwareRenderTargetSize(uint32_t width, uint32_t height)
+{
+	assert(bInitialized == false && "Set the render target size before Initialize");
+	assert(width > 0 && height > 0);
+
+	TargetWidth = width;
+	TargetHeight = height;
+}
+
+const uint32_t* GetSoftwareRenderTarget()
+{
+	return ColorBuffer.data();
+}
+
+bool SaveSoftwareRenderTarget(const char* filePath)
+{
+	assert(filePath != nullptr);
+
+	if (ColorBuffer.empty())
+	{
+		return false;
+	}
+
+	FILE* imageFile = fopen(filePath, "wb");
+
+	if (imageFile == nullptr)
+	{
+		fprintf(stderr, "Could not write %s\n", filePath);
+		return false;
+	}
+
+	//  Ʈ÷ TGAԴϴ. ⺻   Ʒ GL   ۸  ʰ   ֽϴ.
+	const uint8_t header[18] =
+	{
+		0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0
+		, static_cast<uint8_t>(TargetWidth & 0xFF), static_cast<uint8_t>(TargetWidth >> 8)
+		, static_cast<uint8_t>(TargetHeight & 0xFF), static_cast<uint8_t>(TargetHeight >> 8)
+		, 32, 8
+	};
+
+	fwrite(header, sizeof(header), 1, imageFile);
+
+	// TGA BGRA Դϴ.
+	std::vector<uint32_t> row(TargetWidth);
+
+	for (uint32_t y = 0; y < TargetHeight; ++y)
+	{
+		const uint32_t* sourceRow = &ColorBuffer[static_cast<size_t>(y) * TargetWidth];
+
+		for (uint32_t x = 0; x < TargetWidth; ++x)
+		{
+			const uint32_t color = sourceRow[x];
+			row[x] = (color & 0xFF00FF00u) | ((color & 0xFFu) << 16) | ((color >> 16) & 0xFFu);
+		}
+
+		fwrite(row.data(), sizeof(uint32_t), TargetWidth, imageFile);
+	}
+
+	const bool bSucceeded = ferror(imageFile) == 0;
+	fclose(imageFile);
+
+	return bSucceeded;
+}
+
+const SoftwareRenderBackendStats& GetSoftwareRenderBackendStats()
+{
+	return Stats;
+}
+
+void Initialize(uint32_t maxInstanceCount)
+{
+	assert(bInitialized == false && "Initialize called twice");
+	assert(TargetWidth > 0 && TargetHeight > 0 && "SetSoftwareRenderTargetSize must be called before Initialize");
+
+	bInitialized = true;
+	Stats = {};
+
+	ColorBuffer.assign(static_cast<size_t>(TargetWidth) * TargetHeight, CLEAR_COLOR);
+	DepthBuffer.assign(static_cast<size_t>(TargetWidth) * TargetHeight, CLEAR_DEPTH);
+
+	BlockCountX = (TargetWidth + DEPTH_BLOCK_SIZE - 1) / DEPTH_BLOCK_SIZE;
+	BlockMaxDepths.assign(static_cast<size_t>(BlockCountX) * ((TargetHeight + DEPTH_BLOCK_SIZE - 1) / DEPTH_BLOCK_SIZE), CLEAR_DEPTH);
+
+	TileCountX = (TargetWidth + TILE_SIZE - 1) / TILE_SIZE;
+	TileCountY = (TargetHeight + TILE_SIZE - 1) / TILE_SIZE;
+
+	MaxInstanceCount = maxInstanceCount;
+	InstanceTransforms.resize(maxInstanceCount);
+	InstanceTextureAttributes.resize(maxInstanceCount);
+	InstanceStyles.resize(maxInstanceCount);
+	SpriteReferences.reserve(maxInstanceCount);
+	SetupSprites.reserve(maxInstanceCount);
+
+	// ۾  Ǯ(JobPool.h) ׸Ƿ Ʈ   ŭ  ϴ. Ǯ 鿣庸  ʱȭǾ ־ մϴ.
+	BinChunkCount = GetJobThreadCount();
+	TileBins.resize(static_cast<size_t>(BinChunkCount) * TileCountX * TileCountY);
+}
+
+void Shutdown()
+{
+	assert(bInitialized && "Shutdown called before Initialize");
+	assert(bInFrame == false && "Shutdown called inside a frame");
+
+	ColorBuffer = {};
+	DepthBuffer = {};
+
+	for (std::vector<uint32_t>& layerColors : LayerColorBuffers)
+	{
+		layerColors = {};
+	}
+
+	FrameDraws = {};
+	FrameSpriteReferences = {};
+	BlockMaxDepths = {};
+	AtlasTexels = {};
+	InstanceTransforms = {};
+	InstanceTextureAttributes = {};
+	InstanceStyles = {};
+	Draws = {};
+	SpriteReferences = {};
+	SetupSprites = {};
+	TileBins = {};
+
+	bInitialized = false;
+}
+
+bool IsAstcSupported()
+{
+	// ASTC  Ǯ ϹǷ ٸ  ȯ ʿ䰡 ϴ.
+	return true;
+}
+
+void CreateTextureArray(uint32_t format, uint32_t width, uint32_t height, uint32_t layerCount)
+{
+	assert(bInitialized && "CreateTextureArray called before Initialize");
+	assert(format == ASTC_4x4_FORMAT && "The software backend only decodes ASTC 4x4");
+	assert(width == ATLAS_WIDTH && height == ATLAS_HEIGHT && "The band addressing assumes 512x512 layers");
+	assert(layerCount > 0);
+
+	AtlasTexels.assign(static_cast<size_t>(width) * height * layerCount, 0);
+}
+
+void UploadTextureArrayData(size_t dataOffset, const uint8_t* data, size_t dataSize)
+{
+	assert(data != nullptr);
+	assert(dataOffset % BLOCK_SIZE == 0 && dataSize % BLOCK_SIZE == 0);
+	assert(dataOffset + dataSize <= AtlasTexels.size() && "The upload range is outside the texture array");
+
+	// ϸ  Ǯ  Ƿ    ķ óմϴ.
+	const size_t firstBlock = dataOffset / BLOCK_SIZE;
+	const size_t blockCount = dataSize / BLOCK_SIZE;
+	const uint32_t jobCount = static_cast<uint32_t>((blockCount + UPLOAD_JOB_BLOCK_COUNT - 1) / UPLOAD_JOB_BLOCK_COUNT);
+
+	RunJobs(jobCount, [=](uint32_t job)
+	{
+		const size_t jobFirstBlock = job * UPLOAD_JOB_BLOCK_COUNT;
+		const size_t jobBlockCount = std::min(UPLOAD_JOB_BLOCK_COUNT, blockCount - jobFirstBlock);
+
+		DecodeAtlasBlocks(firstBlock + jobFirstBlock, data + jobFirstBlock * BLOCK_SIZE, jobBlockCount);
+	});
+}
+
+void BeginFrame(bool bPreserve)
+{
+	assert(bInitialized && "BeginFrame called before Initialize");
+	assert(bInFrame == false && "BeginFrame called twice");
+
+	bInFrame = true;
+	bPreserveContents = bPreserve;
+	UploadedInstanceCount = 0;
+	ClipRectCount = 0;
+	NineSliceBorderCount = 0;
+	Draws.clear();
+	SpriteReferences.clear();
+
+	FrameBinnedSpriteCount = 0;
+	FrameTileSpriteCount = 0;
+	FrameShadedFragmentCount = 0;
+	FrameRasterTime = 0.0;
+}
+
+void UploadInstances(const glm::mat4* projectionViewWorlds, const glm::uvec4* textureAttributes, const glm::uvec4* spriteStyles, uint32_t instanceCount)
+{
+	assert(bInFrame && "UploadInstances called outside a frame");
+	assert(instanceCount <= MaxInstanceCount && "UploadInstances exceeds the instance buffer");
+
+	std::copy(projectionViewWorlds, projectionViewWorlds + instanceCount, InstanceTransforms.begin());
+	std::copy(textureAttributes, textureAttributes + instanceCount, InstanceTextureAttributes.begin());
+	std::copy(spriteStyles, spriteStyles + instanceCount, InstanceStyles.begin());
+
+	UploadedInstanceCount = instanceCount;
+}
+
+void UploadClipRects(const ScreenRect* rects, uint32_t rectCount)
+{
+	assert(bInFrame && "UploadClipRects called outside a frame");
+	assert(rectCount <= MAX_CLIP_RECT_COUNT && "UploadClipRects exceeds the clip rect table");
+
+	std::copy(rects, rects + rectCount, ClipRects);
+
+	ClipRectCount = rectCount;
+}
+
+void UploadNineSliceBorders(const NineSliceBorder* borders, uint32_t borderCount)
+{
+	assert(bInFrame && "UploadNineSliceBorders called outside a frame");
+	assert(borderCount <= MAX_NINE_SLICE_BORDER_COUNT && "UploadNineSliceBorders exceeds the border table");
+
+	std::copy(borders, borders + borderCount, NineSliceBorders);
+
+	NineSliceBorderCount = borderCount;
+}
+
+void DrawSprites(const SpriteDrawState& drawState, uint32_t firstInstance, uint32_t instanceCount)
+{
+	assert(bInFrame && "DrawSprites called outside a frame");
+	assert(static_cast<uint64_t>(firstInstance) + instanceCount <= UploadedInstanceCount && "DrawSprites reads instances that were not uploaded");
+
+	//  ׸  EndFrame   մϴ. ⼭ ׸  մϴ.
+	RecordDraw(SOFTWARE_DRAW_SPRITES, drawState, firstInstance, instanceCount, CACHED_LAYER_COUNT);
+
+	++Stats.DrawCallCount;
+}
+
+void BeginLayer(uint32_t layer)
+{
+	assert(bInFrame && "BeginLayer called outside a frame");
+	assert(CurrentLayer == CACHED_LAYER_COUNT && "BeginLayer called inside another layer");
+	assert(bInRegion == false && "BeginLayer called inside a region");
+	assert(layer < CACHED_LAYER_COUNT);
+
+	if (LayerColorBuffers[layer].empty())
+	{
+		LayerColorBuffers[layer].resize(static_cast<size_t>(TargetWidth) * TargetHeight);
+	}
+
+	// ̾ ׸    ȭ鿡 ׸  EndLayer ǵϴ.
+	CurrentLayer = layer;
+	FrameDraws.swap(Draws);
+	FrameSpriteReferences.swap(SpriteReferences);
+	Draws.clear();
+	SpriteReferences.clear();
+}
+
+void EndLayer()
+{
+	assert(CurrentLayer < CACHED_LAYER_COUNT && "EndLayer called without BeginLayer");
+
+	// ̾  ӿ Ƿ ̷ ʰ ٷ ׸ϴ.    ռ  ٲ  ϴ.
+	RasterizeDraws(LayerColorBuffers[CurrentLayer].data(), 0, true);
+
+	Draws.swap(FrameDraws);
+	SpriteReferences.swap(FrameSpriteReferences);
+	CurrentLayer = CACHED_LAYER_COUNT;
+
+	++Stats.LayerRedrawCount;
+}
+
+void DrawLayer(uint32_t layer)
+{
+	assert(bInFrame && "DrawLayer called outside a frame");
+	assert(CurrentLayer == CACHED_LAYER_COUNT && "DrawLayer called inside a layer");
+	assert(layer < CACHED_LAYER_COUNT && LayerColorBuffers[layer].empty() == false && "DrawLayer layer was never drawn");
+
+	// ȭ ü  Ʈ ϳ ؼ յ Ʈ   ŸϿ ռմϴ.
+	RecordDraw(SOFTWARE_DRAW_LAYER, {}, 0, 1, layer);
+
+	++Stats.LayerCompositeCount;
+}
+
+void BeginRegion(const ScreenRect& rect)
+{
+	assert(bInFrame && "BeginRegion called outside a frame");
+	assert(bInRegion == false && "BeginRegion called inside another region");
+	assert(CurrentLayer == CACHED_LAYER_COUNT && "BeginRegion called inside a layer");
+	assert(rect.X >= 0 && rect.Y >= 0 && rect.Width > 0 && rect.Height > 0);
+	assert(rect.X + rect.Width <= static_cast<int32_t>(TargetWidth) && rect.Y + rect.Height <= static_cast<int32_t>(TargetHeight));
+
+	bInRegion = true;
+	CurrentRegion = rect;
+
+	//  ͵ ׸   ŸϿ ؾ ϹǷ   ׸ մϴ.
+	RecordDraw(SOFTWARE_DRAW_CLEAR, {}, 0, 1, CACHED_LAYER_COUNT);
+}
+
+void EndRegion()
+{
+	assert(bInRegion && "EndRegion called without BeginRegion");
+
+	bInRegion = false;
+}
+
+void EndFrame()
+{
+	assert(bInFrame && "EndFrame called outside a frame");
+	assert(CurrentLayer == CACHED_LAYER_COUNT && "EndFrame called inside a layer");
+	assert(bInRegion == false && "EndFrame called inside a region");
+
+	RasterizeDraws(ColorBuffer.data(), CLEAR_COLOR, bPreserveContents == false);
+
+	++Stats.FrameCount;
+	Stats.PreservedFrameCount += bPreserveContents ? 1 : 0;
+	Stats.BinnedSpriteCount += FrameBinnedSpriteCount;
+	Stats.TileSpriteCount += FrameTileSpriteCount;
+	Stats.ShadedFragmentCount += FrameShadedFragmentCount;
+	Stats.TotalRasterTime += FrameRasterTime;
+	Stats.MaxRasterTime = std::max(Stats.MaxRasterTime, FrameRasterTime);
+
+	bInFrame = false;
+}
+
+void PrintStats(FILE* stream)
+{
+	assert(stream != nullptr);
+
+	const double frameCount = Stats.FrameCount > 0 ? static_cast<double>(Stats.FrameCount) : 1.0;
+
+	fprintf(stream, "Software backend: %llu frames on %u threads, %.2f ms/frame (max %.2f ms), %.1f draws/frame, %.1f sprites/frame, %.1f tile sprites/frame, %.0f fragments/frame, %llu layer redraws, %llu layer composites, %llu preserved frames\n"
+		, static_cast<unsigned long long>(Stats.FrameCount)
+		, BinChunkCount
+		, Stats.TotalRasterTime / frameCount
+		, Stats.MaxRasterTime
+		, Stats.DrawCallCount / frameCount
+		, Stats.BinnedSpriteCount / frameCount
+		, Stats.TileSpriteCount / frameCount
+		, Stats.ShadedFragmentCount / frameCount
+		, static_cast<unsigned long long>(Stats.LayerRedrawCount)
+		, static_cast<unsigned long long>(Stats.LayerCompositeCount)
+		, static_cast<unsigned long long>(Stats.PreservedFrameCount));
+}
+
+void DecodeAtlasBlocks(size_t firstBlock, const uint8_t* data, size_t blockCount)
+{
+	// ó   ݺǴ 찡 Ƿ 帶  ĳø Ӵϴ.
+	thread_local AstcBlockCache blockCache;
+
+	if (blockCache.Capacity == 0)
+	{
+		InitializeAstcBlockCache(&blockCache, 4, 4, 256);
+	}
+
+	constexpr size_t bandBlockCount = ATLAS_WIDTH / 4;
+
+	for (size_t i = 0; i < blockCount; ++i)
+	{
+		const uint8_t* texels = DecodeAstcBlockCached(&blockCache, data + i * BLOCK_SIZE);
+
+		// ʹ (4)  ̾ Ƿ  ȣ  ȣ   ġ ϴ.
+		const size_t block = firstBlock + i;
+		const size_t band = block / bandBlockCount;
+		const size_t x = block % bandBlockCount * 4;
+
+		for (size_t row = 0; row < 4; ++row)
+		{
+			memcpy(&AtlasTexels[(band * 4 + row) * ATLAS_WIDTH + x], texels + row * 16, 16);
+		}
+	}
+}
+
+void RecordDraw(SoftwareDrawType type, const SpriteDrawState& drawState, uint32_t firstInstance, uint32_t instanceCount, uint32_t layer)
+{
+	SoftwareDraw softwareDraw = { type, drawState, firstInstance, instanceCount, layer, 0, 0, static_cast<int32_t>(TargetWidth), static_cast<int32_t>(TargetHeight) };
+
+	if (bInRegion)
+	{
+		softwareDraw.ClipMinX = CurrentRegion.X;
+		softwareDraw.ClipMinY = CurrentRegion.Y;
+		softwareDraw.ClipMaxX = CurrentRegion.X + CurrentRegion.Width;
+		softwareDraw.ClipMaxY = CurrentRegion.Y + CurrentRegion.Height;
+	}
+
+	const uint32_t draw = static_cast<uint32_t>(Draws.size());
+	Draws.push_back(softwareDraw);
+
+	// ̾ ռ  νϽ Ƿ ȣ 0  ϳ ϴ.
+	for (uint32_t i = 0; i < instanceCount; ++i)
+	{
+		SpriteReferences.push_back({ firstInstance + i, draw });
+	}
+}
+
+void RasterizeDraws(uint32_t* colors, uint32_t clearColor, bool bClear)
+{
+	const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+	TargetColors = colors;
+	TargetClearColor = clearColor;
+	bClearTarget = bClear;
+
+	/*
+		1. Ʈ  ŭ    ȯϰ ġ ŸϿ ϴ.
+		2. Ÿϸ   Ʈ   ׸ϴ. Ÿϳ ȼ  Ƿ  ʿ䰡 ϴ.
+	*/
+	SetupSprites.resize(SpriteReferences.size());
+
+	RunJobs(BinChunkCount, BinSprites);
+	RunJobs(TileCountX * TileCountY, RasterizeTile);
+
+	FrameRasterTime += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+bool SetupSprite(const SpriteReference& reference, SoftwareSprite* outSprite)
+{
+	const SoftwareDraw& draw = Draws[reference.Draw];
+
+	if (draw.Type != SOFTWARE_DRAW_SPRITES)
+	{
+		outSprite->MinX = draw.ClipMinX;
+		outSprite->MinY = draw.ClipMinY;
+		outSprite->MaxX = draw.ClipMaxX;
+		outSprite->MaxY = draw.ClipMaxY;
+		outSprite->Draw = reference.Draw;
+
+		return true;
+	}
+
+	const glm::uvec4& textureAttribute = InstanceTextureAttributes[reference.Instance];
+	const glm::uvec4& style = InstanceStyles[reference.Instance];
+
+	if (textureAttribute.x == 0 || textureAttribute.y == 0)
+	{
+		return false;
+	}
+
+	if (draw.State.bPointSprites)
+	{
+		return SetupPointSprite(reference, outSprite);
+	}
+
+	// ̴  ϴ ǹ ȸ Ŀ ĵθ  ȸ  簢  ˴ϴ.
+	const glm::mat4 projectionViewWorld = InstanceTransforms[reference.Instance] * GetSpriteStyleTransform(style, textureAttribute);
+
+	assert(projectionViewWorld[0].w == 0.0f && projectionViewWorld[1].w == 0.0f && projectionViewWorld[3].w == 1.0f && "Only orthographic projections are supported");
+
+	//  ǥ 0~1   ǥ̹Ƿ 簢     Ÿ  ֽϴ. ̸ ȭ ǥ ٲߴϴ.
+	const float halfWidth = TargetWidth * 0.5f;
+	const float halfHeight = TargetHeight * 0.5f;
+
+	const glm::vec2 origin = { (projectionViewWorld[3].x + 1.0f) * halfWidth, (projectionViewWorld[3].y + 1.0f) * halfHeight };
+	const glm::vec2 edgeU = { projectionViewWorld[0].x * halfWidth, projectionViewWorld[0].y * halfHeight };
+	const glm::vec2 edgeV = { projectionViewWorld[1].x * halfWidth, projectionViewWorld[1].y * halfHeight };
+
+	const float determinant = edgeU.x * edgeV.y - edgeV.x * edgeU.y;
+
+	if (std::abs(determinant) < 1e-6f)
+	{
+		return false;
+	}
+
+	const float minX = std::min({ origin.x, origin.x + edgeU.x, origin.x + edgeV.x, origin.x + edgeU.x + edgeV.x });
+	const float maxX = std::max({ origin.x, origin.x + edgeU.x, origin.x + edgeV.x, origin.x + edgeU.x + edgeV.x });
+	const float minY = std::min({ origin.y, origin.y + edgeU.y, origin.y + edgeV.y, origin.y + edgeU.y + edgeV.y });
+	const float maxY = std::max({ origin.y, origin.y + edgeU.y, origin.y + edgeV.y, origin.y + edgeU.y + edgeV.y });
+
+	SoftwareSprite& sprite = *outSprite;
+	sprite.MinX = std::max(static_cast<int32_t>(std::floor(minX)), draw.ClipMinX);
+	sprite.MinY = std::max(static_cast<int32_t>(std::floor(minY)), draw.ClipMinY);
+	sprite.MaxX = std::min(static_cast<int32_t>(std::ceil(maxX)), draw.ClipMaxX);
+	sprite.MaxY = std::min(static_cast<int32_t>(std::ceil(maxY)), draw.ClipMaxY);
+
+	// Ŭ 簢 ȼ 迡 Ƿ ̴  ̰ų ׸Ʈ      Ͱ ϴ.
+	const uint32_t clipRect = GetSpriteStyleClipRect(style);
+
+	if (clipRect != 0)
+	{
+		assert(clipRect < ClipRectCount && "Sprite references a clip rect that was not uploaded");
+
+		const ScreenRect& rect = ClipRects[clipRect];
+		sprite.MinX = std::max(sprite.MinX, rect.X);
+		sprite.MinY = std::max(sprite.MinY, rect.Y);
+		sprite.MaxX = std::min(sprite.MaxX, rect.X + rect.Width);
+		sprite.MaxY = std::min(sprite.MaxY, rect.Y + rect.Height);
+	}
+
+	if (sprite.MinX >= sprite.MaxX || sprite.MinY >= sprite.MaxY)
+	{
+		return false;
+	}
+
+	// ȭ ǥ  ǥ  ȯԴϴ.
+	const float dudx = edgeV.y / determinant;
+	const float dudy = -edgeV.x / determinant;
+	const float dvdx = -edgeU.y / determinant;
+	const float dvdy = edgeU.x / determinant;
+	const float u0 = -(dudx * origin.x + dudy * origin.y);
+	const float v0 = -(dvdx * origin.x + dvdy * origin.y);
+
+	// ̴ó  ǥ Ʈ ũ⸦   Ʈ ǥ մϴ.
+	const glm::vec2 spriteSize = GetSpriteStyleSize(style, textureAttribute);
+	const uint32_t border = GetSpriteStyleNineSliceBorder(style);
+	const float width = spriteSize.x;
+	const float height = spriteSize.y;
+
+	// ؽó ũ ״ Ʈ Ʈ ǥ  ؽó ǥ̹Ƿ ٲ ʽϴ.
+	sprite.CoordWidth = width;
+	sprite.CoordHeight = height;
+	sprite.bMapTexCoord = border != 0 || width != static_cast<float>(textureAttribute.x) || height != static_cast<float>(textureAttribute.y);
+	sprite.bPointSprite = false;
+
+	if (sprite.bMapTexCoord)
+	{
+		assert((border == 0 || border < NineSliceBorderCount) && "Sprite references a nine-slice border that was not uploaded");
+
+		sprite.TexCoordMapping = GetSpriteTexCoordMapping(spriteSize, textureAttribute, border != 0 ? NineSliceBorders[border] : NineSliceBorder{});
+	}
+
+	sprite.S0 = u0 * width;
+	sprite.DsDx = dudx * width;
+	sprite.DsDy = dudy * width;
+	sprite.T0 = v0 * height;
+	sprite.DtDx = dvdx * height;
+	sprite.DtDy = dvdy * height;
+
+	//  ̴   ǥ  1 -  ǥ ؽó нϴ.
+	if (style.x & SPRITE_STYLE_FLIP_X)
+	{
+		sprite.S0 = width - sprite.S0;
+		sprite.DsDx = -sprite.DsDx;
+		sprite.DsDy = -sprite.DsDy;
+	}
+
+	if (style.x & SPRITE_STYLE_FLIP_Y)
+	{
+		sprite.T0 = height - sprite.T0;
+		sprite.DtDx = -sprite.DtDx;
+		sprite.DtDy = -sprite.DtDy;
+	}
+
+	// ȭ (-1~1)  (0~1) ٲߴϴ.
+	const float depthU = projectionViewWorld[0].z * 0.5f;
+	const float depthV = projectionViewWorld[1].z * 0.5f;
+
+	sprite.Depth0 = projectionViewWorld[3].z * 0.5f + 0.5f + depthU * u0 + depthV * v0;
+	sprite.DepthDx = depthU * dudx + depthV * dvdx;
+	sprite.DepthDy = depthU * dudy + depthV * dvdy;
+
+	// ̳  ۿ ִ Ʈ GL  ׸ ʽϴ. Ʈ ϹǷ  Ȯմϴ.
+	const float originDepth = projectionViewWorld[3].z * 0.5f + 0.5f;
+	const float minDepth = std::min({ originDepth, originDepth + depthU, originDepth + depthV, originDepth + depthU + depthV });
+	const float maxDepth = std::max({ originDepth, originDepth + depthU, originDepth + depthV, originDepth + depthU + depthV });
+
+	if (maxDepth < 0.0f || minDepth > 1.0f)
+	{
+		return false;
+	}
+
+	sprite.MinDepth = minDepth - 1e-5f;
+
+	sprite.Width = textureAttribute.x;
+	sprite.Height = textureAttribute.y;
+	sprite.StartX = textureAttribute.z;
+	sprite.StartBand = textureAttribute.w;
+	sprite.RowPitch = (textureAttribute.x + 3) & ~3u;
+	sprite.Tint = GetSpriteStyleTint(style);
+	sprite.Draw = reference.Draw;
+
+	return true;
+}
+
+bool SetupPointSprite(const SpriteReference& reference, SoftwareSprite* outSprite)
+{
+	const SoftwareDraw& draw = Draws[reference.Draw];
+	const glm::mat4& projectionViewWorld = InstanceTransforms[reference.Instance];
+	const glm::uvec4& textureAttribute = InstanceTextureAttributes[reference.Instance];
+	const glm::uvec4& style = InstanceStyles[reference.Instance];
+
+	assert(draw.State.Pass == SPRITE_BLEND_OPAQUE && GetSpriteStyleClipRect(style) == 0 && "Point sprites must be opaque and unclipped");
+
+	const glm::vec4 center = GetSpritePointCenter(projectionViewWorld, style, textureAttribute);
+	const float halfSize = GetSpritePointSize(projectionViewWorld, style, glm::vec2(TargetWidth, TargetHeight)) * 0.5f;
+
+	// GL   ̳  ۿ ִ  ׸ ʽϴ.
+	const float depth = center.z * 0.5f + 0.5f;
+
+	if (depth < 0.0f || depth > 1.0f)
+	{
+		return false;
+	}
+
+	// ȼ ߽ 簢 ȿ ִ ȼ ĥմϴ.
+	const float centerX = (center.x + 1.0f) * 0.5f * TargetWidth;
+	const float centerY = (center.y + 1.0f) * 0.5f * TargetHeight;
+
+	SoftwareSprite& sprite = *outSprite;
+	sprite.MinX = std::max(static_cast<int32_t>(std::ceil(centerX - halfSize - 0.5f)), draw.ClipMinX);
+	sprite.MinY = std::max(static_cast<int32_t>(std::ceil(centerY - halfSize - 0.5f)), draw.ClipMinY);
+	sprite.MaxX = std::min(static_cast<int32_t>(std::ceil(centerX + halfSize - 0.5f)), draw.ClipMaxX);
+	sprite.MaxY = std::min(static_cast<int32_t>(std::ceil(centerY + halfSize - 0.5f)), draw.ClipMaxY);
+
+	if (sprite.MinX >= sprite.MaxX || sprite.MinY >= sprite.MaxY)
+	{
+		return false;
+	}
+
+	//  ȿ ؽó ǥ ̰ ٲ ʽϴ. ǥ  ˻縸 ϸ ǹǷ  Ӵϴ.
+	sprite.S0 = 0.5f;
+	sprite.DsDx = 0.0f;
+	sprite.DsDy = 0.0f;
+	sprite.T0 = 0.5f;
+	sprite.DtDx = 0.0f;
+	sprite.DtDy = 0.0f;
+	sprite.CoordWidth = 1.0f;
+	sprite.CoordHeight = 1.0f;
+	sprite.bMapTexCoord = false;
+	sprite.bPointSprite = true;
+	sprite.Depth0 = depth;
+	sprite.DepthDx = 0.0f;
+	sprite.DepthDy = 0.0f;
+	sprite.MinDepth = depth - 1e-5f;
+
+	sprite.Width = textureAttribute.x;
+	sprite.Height = textureAttribute.y;
+	sprite.StartX = textureAttribute.z;
+	sprite.StartBand = textureAttribute.w;
+	sprite.RowPitch = (textureAttribute.x + 3) & ~3u;
+
+	// Ĵ  ũ⿡ ̹ ݿǷ ̴  ϰ ϴ.
+	sprite.Tint = glm::vec4(glm::vec3(GetSpriteStyleTint(style)), 1.0f);
+	sprite.Draw = reference.Draw;
+
+	return true;
+}
+
+void BinSprites(uint32_t chunk)
+{
+	const uint32_t tileCount = TileCountX * TileCountY;
+	const size_t spriteCount = SpriteReferences.size();
+	const size_t beginSprite = spriteCount * chunk / BinChunkCount;
+	const size_t endSprite = spriteCount * (chunk + 1) / BinChunkCount;
+
+	std::vector<uint32_t>* bins = &TileBins[static_cast<size_t>(chunk) * tileCount];
+
+	for (uint32_t tile = 0; tile < tileCount; ++tile)
+	{
+		bins[tile].clear();
+	}
+
+	uint64_t binnedSpriteCount = 0;
+	uint64_t tileSpriteCount = 0;
+
+	for (size_t i = beginSprite; i < endSprite; ++i)
+	{
+		SoftwareSprite& sprite = SetupSprites[i];
+
+		if (SetupSprite(SpriteReferences[i], &sprite) == false)
+		{
+			continue;
+		}
+
+		const uint32_t tileMinX = sprite.MinX / TILE_SIZE;
+		const uint32_t tileMinY = sprite.MinY / TILE_SIZE;
+		const uint32_t tileMaxX = (sprite.MaxX - 1) / TILE_SIZE;
+		const uint32_t tileMaxY = (sprite.MaxY - 1) / TILE_SIZE;
+
+		for (uint32_t tileY = tileMinY; tileY <= tileMaxY; ++tileY)
+		{
+			for (uint32_t tileX = tileMinX; tileX <= tileMaxX; ++tileX)
+			{
+				bins[tileY * TileCountX + tileX].push_back(static_cast<uint32_t>(i));
+			}
+		}
+
+		++binnedSpriteCount;
+		tileSpriteCount += (tileMaxX - tileMinX + 1) * (tileMaxY - tileMinY + 1);
+	}
+
+	FrameBinnedSpriteCount += binnedSpriteCount;
+	FrameTileSpriteCount += tileSpriteCount;
+}
+
+void RasterizeTile(uint32_t tile)
+{
+	const int32_t tileMinX = static_cast<int32_t>(tile % TileCountX) * TILE_SIZE;
+	const int32_t tileMinY = static_cast<int32_t>(tile / TileCountX) * TILE_SIZE;
+	const int32_t tileMaxX = std::min(tileMinX + TILE_SIZE, static_cast<int32_t>(TargetWidth));
+	const int32_t tileMaxY = std::min(tileMinY + TILE_SIZE, static_cast<int32_t>(TargetHeight));
+
+	if (bClearTarget)
+	{
+		ClearRect(tileMinX, tileMinY, tileMaxX, tileMaxY);
+	}
+
+	const uint32_t tileCount = TileCountX * TileCountY;
+	uint64_t shadedFragmentCount = 0;
+
+	for (uint32_t chunk = 0; chunk < BinChunkCount; ++chunk)
+	{
+		for (const uint32_t spriteIndex : TileBins[static_cast<size_t>(chunk) * tileCount + tile])
+		{
+			const SoftwareSprite& sprite = SetupSprites[spriteIndex];
+			const SoftwareDraw& draw = Draws[sprite.Draw];
+
+			// ̾ ռ   ̹Ƿ Ÿϰ ġ κи óմϴ.
+			const int32_t minX = std::max(sprite.MinX, tileMinX);
+			const int32_t minY = std::max(sprite.MinY, tileMinY);
+			const int32_t maxX = std::min(sprite.MaxX, tileMaxX);
+			const int32_t maxY = std::min(sprite.MaxY, tileMaxY);
+
+			switch (draw.Type)
+			{
+			case SOFTWARE_DRAW_SPRITES:
+				shadedFragmentCount += RasterizeSprite(sprite, tileMinX, tileMinY, tileMaxX, tileMaxY);
+				break;
+
+			case SOFTWARE_DRAW_LAYER:
+				shadedFragmentCount += CompositeLayer(draw.Layer, minX, minY, maxX, maxY);
+				break;
+
+			case SOFTWARE_DRAW_CLEAR:
+				ClearRect(minX, minY, maxX, maxY);
+				break;
+			}
+		}
+	}
+
+	FrameShadedFragmentCount += shadedFragmentCount;
+}
+
+void ClearRect(int32_t minX, int32_t minY, int32_t maxX, int32_t maxY)
+{
+	for (int32_t y = minY; y < maxY; ++y)
+	{
+		const size_t rowOffset = static_cast<size_t>(y) * TargetWidth;
+
+		std::fill(TargetColors + rowOffset + minX, TargetColors + rowOffset + maxX, TargetClearColor);
+		std::fill(&DepthBuffer[rowOffset + minX], &DepthBuffer[rowOffset + maxX], CLEAR_DEPTH);
+	}
+
+	//  Ϻθ    ̴  ̰ ˴ϴ.  ̰   ̹Ƿ  ٽ  ʿ䰡 ϴ.
+	for (int32_t blockY = minY / DEPTH_BLOCK_SIZE; blockY * DEPTH_BLOCK_SIZE < maxY; ++blockY)
+	{
+		const size_t rowOffset = static_cast<size_t>(blockY) * BlockCountX;
+
+		std::fill(&BlockMaxDepths[rowOffset + minX / DEPTH_BLOCK_SIZE], &BlockMaxDepths[rowOffset + (maxX + DEPTH_BLOCK_SIZE - 1) / DEPTH_BLOCK_SIZE], CLEAR_DEPTH);
+	}
+}
+
+uint64_t CompositeLayer(uint32_t layer, int32_t minX, int32_t minY, int32_t maxX, int32_t maxY)
+{
+	// GL_ONE, GL_ONE_MINUS_SRC_ALPHA  ׸ϴ. ̴ ˻ϰų  ʽϴ.
+	const uint32_t* layerColors = LayerColorBuffers[layer].data();
+	uint64_t shadedFragmentCount = 0;
+
+	for (int32_t y = minY; y < maxY; ++y)
+	{
+		const size_t rowOffset = static_cast<size_t>(y) * TargetWidth;
+		const uint32_t* sourceRow = layerColors + rowOffset;
+		uint32_t* destinationRow = TargetColors + rowOffset;
+		int32_t x = minX;
+
+#if defined(SOFTWARE_RENDER_USE_SSE2)
+		// ̾ κ ų ϹǷ 4ȼ о     ȼ ϳ ϴ.
+		const __m128i opaqueAlpha = _mm_set1_epi32(255);
+
+		for (; x + 4 <= maxX; x += 4)
+		{
+			const __m128i sources = _mm_loadu_si128(reinterpret_cast<const __m128i*>(sourceRow + x));
+			const int emptyMask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(sources, _mm_setzero_si128())));
+
+			if (emptyMask == 0xF)
+			{
+				continue;
+			}
+
+			const __m128i opaqueLanes = _mm_cmpeq_epi32(_mm_srli_epi32(sources, 24), opaqueAlpha);
+			const int blendMask = ~(emptyMask | _mm_movemask_ps(_mm_castsi128_ps(opaqueLanes))) & 0xF;
+
+			__m128i* destinations = reinterpret_cast<__m128i*>(destinationRow + x);
+			_mm_storeu_si128(destinations, _mm_or_si128(_mm_and_si128(opaqueLanes, sources), _mm_andnot_si128(opaqueLanes, _mm_loadu_si128(destinations))));
+
+			for (int i = 0; blendMask != 0 && i < 4; ++i)
+			{
+				if ((blendMask & (1 << i)) != 0)
+				{
+					destinationRow[x + i] = BlendLayerPixel(sourceRow[x + i], destinationRow[x + i]);
+				}
+			}
+
+			shadedFragmentCount += 4 - CountLaneMaskBits(emptyMask);
+		}
+#endif
+
+		for (; x < maxX; ++x)
+		{
+			const uint32_t source = sourceRow[x];
+
+			// ƹ͵ ׸  ȼ 0̰, θ ׸ ȼ İ 0̾  ֽϴ.
+			if (source == 0)
+			{
+				continue;
+			}
+
+			++shadedFragmentCount;
+
+			destinationRow[x] = (source >> 24) == 255 ? source : BlendLayerPixel(source, destinationRow[x]);
+		}
+	}
+
+	return shadedFragmentCount;
+}
+
+uint32_t BlendLayerPixel(uint32_t source, uint32_t destination)
+{
+	// ̾ Ƽö̵ ̹Ƿ  ״ ϰ 󿡸 1 - ĸ մϴ.
+	const float destinationFactor = 1.0f - (source >> 24) * (1.0f / 255.0f);
+
+#if defined(SOFTWARE_RENDER_USE_SSE2)
+	const __m128i zero = _mm_setzero_si128();
+
+	const __m128i sourceChannels = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(static_cast<int>(source)), zero), zero);
+	const __m128i destinationChannels = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(static_cast<int>(destination)), zero), zero);
+	const __m128 values = _mm_add_ps(_mm_cvtepi32_ps(sourceChannels), _mm_mul_ps(_mm_cvtepi32_ps(destinationChannels), _mm_set1_ps(destinationFactor)));
+
+	__m128i packed = _mm_cvttps_epi32(_mm_min_ps(_mm_add_ps(values, _mm_set1_ps(0.5f)), _mm_set1_ps(255.0f)));
+	packed = _mm_packs_epi32(packed, packed);
+	packed = _mm_packus_epi16(packed, packed);
+
+	return static_cast<uint32_t>(_mm_cvtsi128_si32(packed));
+#else
+	uint32_t result = 0;
+
+	for (int channel = 0; channel < 4; ++channel)
+	{
+		const float value = ((source >> (channel * 8)) & 0xFF) + ((destination >> (channel * 8)) & 0xFF) * destinationFactor;
+		result |= static_cast<uint32_t>(std::min(value + 0.5f, 255.0f)) << (channel * 8);
+	}
+
+	return result;
+#endif
+}
+
+uint64_t RasterizeSprite(const SoftwareSprite& sprite, int32_t tileMinX, int32_t tileMinY, int32_t tileMaxX, int32_t tileMaxY)
+{
+	const SpriteDrawState& drawState = Draws[sprite.Draw].State;
+
+	SpriteRasterState state;
+	state.bAlphaTest = drawState.Pass != SPRITE_BLEND_OPAQUE;
+	state.bBlend = drawState.Pass == SPRITE_BLEND_TRANSLUCENT;
+	state.bAdditive = drawState.BlendMode == MATERIAL_BLEND_ADDITIVE;
+	state.bDepthTest = drawState.bDepthTest;
+	state.bDepthWrite = drawState.bDepthTest && state.bBlend == false; //  ˻縦  GL ̸  ʽϴ.
+	// ̴ ؼ Ƽ  νϽ  ʷ մϴ.    ؼ   մϴ.
+	const glm::vec4 tint = drawState.Tint * sprite.Tint;
+	state.bUntinted = tint == glm::vec4(1.0f);
+
+	for (int channel = 0; channel < 4; ++channel)
+	{
+		state.Tint[channel] = tint[channel];
+	}
+
+	const int32_t minX = std::max(sprite.MinX, tileMinX);
+	const int32_t maxX = std::min(sprite.MaxX, tileMaxX);
+	const int32_t minY = std::max(sprite.MinY, tileMinY);
+	const int32_t maxY = std::min(sprite.MaxY, tileMaxY);
+
+	uint64_t shadedFragmentCount = 0;
+
+	/*
+		8x8 ϸ   ̸ ؼ Ʈ   ̺ տ   ° ǳʶݴϴ.
+		 н տ   ȭ ä  ڿ ִ Ʈ ȼ ϳ ˻ ʰ ɷϴ.
+	*/
+	for (int32_t blockMinY = minY & ~(DEPTH_BLOCK_SIZE - 1); blockMinY < maxY; blockMinY += DEPTH_BLOCK_SIZE)
+	{
+		for (int32_t blockMinX = minX & ~(DEPTH_BLOCK_SIZE - 1); blockMinX < maxX; blockMinX += DEPTH_BLOCK_SIZE)
+		{
+			float& blockMaxDepth = BlockMaxDepths[(blockMinY / DEPTH_BLOCK_SIZE) * BlockCountX + blockMinX / DEPTH_BLOCK_SIZE];
+
+			if (state.bDepthTest && (sprite.MinDepth < blockMaxDepth) == false)
+			{
+				continue;
+			}
+
+			const int32_t spanMinX = std::max(blockMinX, minX);
+			const int32_t spanMaxX = std::min(blockMinX + DEPTH_BLOCK_SIZE, maxX);
+			const int32_t spanMaxY = std::min(blockMinY + DEPTH_BLOCK_SIZE, maxY);
+
+			uint64_t blockFragmentCount = 0;
+
+			for (int32_t y = std::max(blockMinY, minY); y < spanMaxY; ++y)
+			{
+				blockFragmentCount += RasterizeSpan(sprite, state, y, spanMinX, spanMaxX);
+			}
+
+			// ̸     ̰   Ƿ ٽ մϴ.
+			if (state.bDepthWrite && blockFragmentCount > 0)
+			{
+				blockMaxDepth = GetBlockMaxDepth(blockMinX, blockMinY);
+			}
+
+			shadedFragmentCount += blockFragmentCount;
+		}
+	}
+
+	return shadedFragmentCount;
+}
+
+uint64_t RasterizeSpan(const SoftwareSprite& sprite, const SpriteRasterState& state, int32_t y, int32_t minX, int32_t maxX)
+{
+	// ȼ ߽ɿ մϴ.     x = 0 ȼ ߽ɿ Դϴ.
+	const float centerY = y + 0.5f;
+	const float s = sprite.S0 + sprite.DsDy * centerY + sprite.DsDx * 0.5f;
+	const float t = sprite.T0 + sprite.DtDy * centerY + sprite.DtDx * 0.5f;
+	const float depth = sprite.Depth0 + sprite.DepthDy * centerY + sprite.DepthDx * 0.5f;
+
+	// ؽó ǥ 簢 ȿ ִ  ϴ.
+	int32_t beginX = minX;
+	int32_t endX = maxX;
+
+	if (ClipSpan(s, sprite.DsDx, sprite.CoordWidth, &beginX, &endX) == false
+		|| ClipSpan(t, sprite.DtDx, sprite.CoordHeight, &beginX, &endX) == false)
+	{
+		return 0;
+	}
+
+	uint32_t* colorRow = TargetColors + static_cast<size_t>(y) * TargetWidth;
+	float* depthRow = &DepthBuffer[static_cast<size_t>(y) * TargetWidth];
+
+	uint64_t shadedFragmentCount = 0;
+	int32_t x = beginX;
+
+#if defined(SOFTWARE_RENDER_USE_SSE2)
+	/*
+		 ˻縦 4ȼ   մϴ.   ʴ  н ؼ ״ Ƿ  ˻,    4ȼ մϴ.
+		SSE2  д   ؼ ϳ нϴ. ų  ϴ ȼ ShadeFragment ϳ ̵մϴ.
+		̿ ؽó ǥ Ʒ Į ݺ   ؼ   ׷  ϴ.
+	*/
+	const bool bCopyFragments = state.bUntinted && state.bBlend == false;
+
+	if (state.bDepthTest || bCopyFragments)
+	{
+		const __m128 laneOffsets = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+		const __m128 alphaScale = _mm_set1_ps(1.0f / 255.0f);
+		const __m128 alphaThreshold = _mm_set1_ps(ALPHA_TEST_THRESHOLD);
+		const __m128 allLanes = _mm_castsi128_ps(_mm_set1_epi32(-1));
+
+		for (; x + 4 <= endX; x += 4)
+		{
+			const __m128 fragmentDepths = _mm_add_ps(_mm_set1_ps(depth), _mm_mul_ps(_mm_set1_ps(sprite.DepthDx), _mm_add_ps(_mm_set1_ps(static_cast<float>(x)), laneOffsets)));
+			const __m128 depthPassMask = state.bDepthTest ? _mm_cmplt_ps(fragmentDepths, _mm_loadu_ps(depthRow + x)) : allLanes;
+			const int passMask = _mm_movemask_ps(depthPassMask);
+
+			if (passMask == 0)
+			{
+				continue;
+			}
+
+			shadedFragmentCount += CountLaneMaskBits(passMask);
+
+			if (bCopyFragments)
+			{
+				const __m128i texels = _mm_setr_epi32(
+					static_cast<int>(FetchAtlasTexel(sprite, s + sprite.DsDx * x, t + sprite.DtDx * x)),
+					static_cast<int>(FetchAtlasTexel(sprite, s + sprite.DsDx * (x + 1), t + sprite.DtDx * (x + 1))),
+					static_cast<int>(FetchAtlasTexel(sprite, s + sprite.DsDx * (x + 2), t + sprite.DtDx * (x + 2))),
+					static_cast<int>(FetchAtlasTexel(sprite, s + sprite.DsDx * (x + 3), t + sprite.DtDx * (x + 3))));
+
+				__m128 writeMask = depthPassMask;
+
+				if (state.bAlphaTest)
+				{
+					const __m128 alphas = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(texels, 24)), alphaScale);
+					writeMask = _mm_and_ps(writeMask, _mm_cmpge_ps(alphas, alphaThreshold));
+				}
+
+				const __m128i colorWriteMask = _mm_castps_si128(writeMask);
+				__m128i* colors = reinterpret_cast<__m128i*>(colorRow + x);
+				_mm_storeu_si128(colors, _mm_or_si128(_mm_and_si128(colorWriteMask, texels), _mm_andnot_si128(colorWriteMask, _mm_loadu_si128(colors))));
+
+				if (state.bDepthWrite)
+				{
+					_mm_storeu_ps(depthRow + x, _mm_or_ps(_mm_and_ps(writeMask, fragmentDepths), _mm_andnot_ps(writeMask, _mm_loadu_ps(depthRow + x))));
+				}
+
+				continue;
+			}
+
+			alignas(16) float passDepths[4];
+			_mm_store_ps(passDepths, fragmentDepths);
+
+			for (int i = 0; i < 4; ++i)
+			{
+				if ((passMask & (1 << i)) == 0)
+				{
+					continue;
+				}
+
+				const uint32_t texel = FetchAtlasTexel(sprite, s + sprite.DsDx * (x + i), t + sprite.DtDx * (x + i));
+				ShadeFragment(state, texel, passDepths[i], colorRow + x + i, depthRow + x + i);
+			}
+		}
+	}
+#endif
+
+	for (; x < endX; ++x)
+	{
+		const float fragmentDepth = depth + sprite.DepthDx * x;
+
+		//  Լ GL ⺻ GL_LESSԴϴ.
+		if (state.bDepthTest && (fragmentDepth < depthRow[x]) == false)
+		{
+			continue;
+		}
+
+		const uint32_t texel = FetchAtlasTexel(sprite, s + sprite.DsDx * x, t + sprite.DtDx * x);
+		ShadeFragment(state, texel, fragmentDepth, colorRow + x, depthRow + x);
+		++shadedFragmentCount;
+	}
+
+	return shadedFragmentCount;
+}
+
+float GetBlockMaxDepth(int32_t blockMinX, int32_t blockMinY)
+{
+	const int32_t blockMaxX = std::min(blockMinX + DEPTH_BLOCK_SIZE, static_cast<int32_t>(TargetWidth));
+	const int32_t blockMaxY = std::min(blockMinY + DEPTH_BLOCK_SIZE, static_cast<int32_t>(TargetHeight));
+
+	float maxDepth = 0.0f;
+
+	for (int32_t y = blockMinY; y < blockMaxY; ++y)
+	{
+		const float* depthRow = &DepthBuffer[static_cast<size_t>(y) * TargetWidth];
+		maxDepth = std::max(maxDepth, *std::max_element(depthRow + blockMinX, depthRow + blockMaxX));
+	}
+
+	return maxDepth;
+}
+
+bool ClipSpan(float value, float step, float limit, int32_t* begin, int32_t* end)
+{
+	// value + step * x [0, limit) ȿ ִ  x ϴ.
+	if (step == 0.0f)
+	{
+		return value >= 0.0f && value < limit;
+	}
+
+	float first = 0.0f;
+	float last = 0.0f;
+
+	if (step > 0.0f)
+	{
+		first = std::ceil(-value / step);
+		last = std::ceil((limit - value) / step);
+	}
+	else
+	{
+		first = std::floor((limit - value) / step) + 1.0f;
+		last = std::floor(-value / step) + 1.0f;
+	}
+
+	// ȭ  ָ    ġ ʵ    ڸϴ.
+	*begin = static_cast<int32_t>(std::max(first, static_cast<float>(*begin)));
+	*end = static_cast<int32_t>(std::min(last, static_cast<float>(*end)));
+
+	return *begin < *end;
+}
+
+uint32_t FetchAtlasTexel(const SoftwareSprite& sprite, float s, float t)
+{
+	//   ؼ   Ͱ ϴ.
+	if (sprite.bPointSprite)
+	{
+		return 0xFFFFFFFFu;
+	}
+
+	if (sprite.bMapTexCoord)
+	{
+		const glm::vec2 texCoord = MapSpriteTexCoord(sprite.TexCoordMapping, glm::vec2(s, t));
+		s = texCoord.x;
+		t = texCoord.y;
+	}
+
+	// ̴  ؽó ǥ  ؼ ġ մϴ.      ʰ ڸϴ.
+	const uint32_t texelX = std::min(static_cast<uint32_t>(std::max(s, 0.0f)), sprite.Width - 1);
+	const uint32_t texelY = std::min(static_cast<uint32_t>(std::max(t, 0.0f)), sprite.Height - 1);
+
+	// ؽó 4ٸ    ũ⸸ŭ ڿ ְ, 512  ŭ   Ѿϴ.
+	const uint32_t x = sprite.StartX + (texelY >> 2) * sprite.RowPitch + texelX;
+	const uint32_t band = sprite.StartBand + (x >> 9);
+
+	// Ǯ ̴ , ,  ̹Ƿ  ȣ    ̾ ̸   ȣԴϴ.
+	const size_t index = ((static_cast<size_t>(band) << 2 | (texelY & 3)) << 9) | (x & 511);
+	assert(index < AtlasTexels.size());
+
+	return AtlasTexels[index];
+}
+
+void ShadeFragment(const SpriteRasterState& state, uint32_t texel, float depth, uint32_t* color, float* depthValue)
+{
+	const uint32_t texelAlpha = texel >> 24;
+
+	//      ϰų  ʴ ؼ ״ ̰,   ؼ  ٲ  ϴ.
+	if (state.bUntinted && (state.bBlend == false || (texelAlpha == 255 && state.bAdditive == false)))
+	{
+		if (state.bAlphaTest && texelAlpha * (1.0f / 255.0f) < ALPHA_TEST_THRESHOLD)
+		{
+			return;
+		}
+
+		*color = texel;
+	}
+	else if (state.bBlend && texelAlpha == 0)
+	{
+		//   ؼ   ״̰  н ̵  Ƿ ǳʶݴϴ.
+		return;
+	}
+	else
+	{
+#if defined(SOFTWARE_RENDER_USE_SSE2)
+		const __m128i zero = _mm_setzero_si128();
+		const __m128 scale = _mm_set1_ps(1.0f / 255.0f);
+
+		const __m128i texelChannels = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(static_cast<int>(texel)), zero), zero);
+		const __m128 source = _mm_mul_ps(_mm_mul_ps(_mm_cvtepi32_ps(texelChannels), scale), _mm_loadu_ps(state.Tint));
+		const float alpha = _mm_cvtss_f32(_mm_shuffle_ps(source, source, _MM_SHUFFLE(3, 3, 3, 3)));
+
+		if (state.bAlphaTest && alpha < ALPHA_TEST_THRESHOLD)
+		{
+			return;
+		}
+
+		__m128 result = source;
+
+		if (state.bBlend)
+		{
+			/*
+				 GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA Ǵ  GL_SRC_ALPHA, GL_ONEԴϴ.
+				Ĵ GL_ONE, GL_ONE_MINUS_SRC_ALPHA Ǵ GL_ZERO, GL_ONE̶ ĳ ̾ Ƽö̵ ķ Դϴ.
+			*/
+			const __m128i destinationChannels = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(static_cast<int>(*color)), zero), zero);
+			const __m128 destination = _mm_mul_ps(_mm_cvtepi32_ps(destinationChannels), scale);
+			const __m128 sourceFactor = _mm_setr_ps(alpha, alpha, alpha, state.bAdditive ? 0.0f : 1.0f);
+			const __m128 destinationFactor = _mm_set1_ps(state.bAdditive ? 1.0f : 1.0f - alpha);
+
+			result = _mm_add_ps(_mm_mul_ps(source, sourceFactor), _mm_mul_ps(destination, destinationFactor));
+		}
+
+		// 0~1 ڸ   8Ʈ  ݿøմϴ.
+		result = _mm_min_ps(_mm_max_ps(result, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+		__m128i packed = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(result, _mm_set1_ps(255.0f)), _mm_set1_ps(0.5f)));
+		packed = _mm_packs_epi32(packed, packed);
+		packed = _mm_packus_epi16(packed, packed);
+
+		*color = static_cast<uint32_t>(_mm_cvtsi128_si32(packed));
+#else
+		float source[4];
+
+		for (int channel = 0; channel < 4; ++channel)
+		{
+			source[channel] = ((texel >> (channel * 8)) & 0xFF) * (1.0f / 255.0f) * state.Tint[channel];
+		}
+
+		const float alpha = source[3];
+
+		if (state.bAlphaTest && alpha < ALPHA_TEST_THRESHOLD)
+		{
+			return;
+		}
+
+		uint32_t result = 0;
+
+		for (int channel = 0; channel < 4; ++channel)
+		{
+			float value = source[channel];
+
+			if (state.bBlend)
+			{
+				const float destination = ((*color >> (channel * 8)) & 0xFF) * (1.0f / 255.0f);
+				const float sourceFactor = channel < 3 ? alpha : (state.bAdditive ? 0.0f : 1.0f);
+				value = value * sourceFactor + destination * (state.bAdditive ? 1.0f : 1.0f - alpha);
+			}
+
+			value = std::min(std::max(value, 0.0f), 1.0f);
+			result |= static_cast<uint32_t>(value * 255.0f + 0.5f) << (channel * 8);
+		}
+
+		*color = result;
+#endif
+	}
+
+	if (state.bDepthWrite)
+	{
+		*depthValue = depth;
+	}
+}
+
+#if defined(SOFTWARE_RENDER_USE_SSE2)
+uint32_t CountLaneMaskBits(int laneMask)
+{
+	// _mm_movemask_ps 4Ʈ     ϴ.
+	return (laneMask & 1) + ((laneMask >> 1) & 1) + ((laneMask >> 2) & 1) + ((laneMask >> 3) & 1);
+}
+#endif
@@ -0,0 +1,47 @@
+#pragma once
+
+/*
+	GPU  CPU Ʈ ׸  鿣Դϴ.
+	GPU   ÷ ,  ī带 ų ȸ ׽Ʈ  ̹   մϴ.
+
+	SpriteVS.glsl, SpriteFS.glsl    簢 ȯ, ؽó   ּ ,
+	 ׽Ʈ,  ˻,  ״  մϴ.
+	Ʈ ȭ ŸϺ    Ÿϸ ķ ׸, ؽó ASTC ̸ RGBA8 Ǯ 纻 нϴ.
+	ĳ ̾ ȭ ũ  ۸  ΰ EndLayer ٷ ׷Ӵϴ.
+	ȭ ϴ ӿ BeginRegion  , ׸⸶ ׶  ߶ ׸ϴ.
+	νϽ Ŭ 簢 Ʈ  ȼ  ٿ,  ̽ ؼ   ǥ ٲ㼭 մϴ.
+	 ׸ Ʈ ؼ  νϽ  ä 簢Դϴ.
+
+	  մϴ.  GL  Ʒ ٺ ˴ϴ.
+*/
+
+#include <cstdint>
+
+#include "RenderBackend.h"
+
+struct SoftwareRenderBackendStats
+{
+	uint64_t FrameCount;
+	uint64_t DrawCallCount;
+	uint64_t BinnedSpriteCount; // ȭ ȿ ͼ ŸϿ  Ʈ Դϴ.
+	uint64_t TileSpriteCount; // Ÿϰ Ʈ ģ ȽԴϴ. Ÿ 迡 ģ Ʈ   ϴ.
+	uint64_t ShadedFragmentCount; //  ˻縦 ؼ ؽó  ׸Ʈ Դϴ.
+	uint64_t LayerRedrawCount; // ĳ ̾ ٽ ׸ ȽԴϴ.
+	uint64_t LayerCompositeCount;
+	uint64_t PreservedFrameCount;
+	double TotalRasterTime; // и Դϴ.
+	double MaxRasterTime;
+};
+
+const RenderBackend& GetSoftwareRenderBackend();
+
+//  Ÿ ũ⸦ մϴ. Initialize  ȣؾ ˴ϴ.
+void SetSoftwareRenderTargetSize(uint32_t width, uint32_t height);
+
+//     Դϴ. ȼ RGBA  4ƮԴϴ.
+const uint32_t* GetSoftwareRenderTarget();
+
+//    32Ʈ TGA Ϸ մϴ.
+bool SaveSoftwareRenderTarget(const char* filePath);
+
+const SoftwareRenderBackendStats& GetSoftwareRenderBackendStats();
@@ -0,0 +1,181 @@
+#include "SpriteStyle.h"
+
+#include <cmath>
+#include <cassert>
+#include <algorithm>
+
+#include "RenderBackend.h"
+
+/*** Constant Variables ***/
+static constexpr float TWO_PI = 6.28318530718f;
+static constexpr float ROTATION_STEPS = 65536.0f;
+static constexpr float PIVOT_STEPS = 32768.0f;
+
+glm::uvec4 PackSpriteStyle(float rotation, const glm::vec2& pivot, bool bFlipX, bool bFlipY, const glm::vec4& tint)
+{
+	//     Ѵ  16Ʈ θ   ˴ϴ.
+	const int64_t rotationStep = static_cast<int64_t>(std::floor(rotation / TWO_PI * ROTATION_STEPS + 0.5f));
+	const uint32_t packedRotation = static_cast<uint32_t>(rotationStep) & 0xFFFFu;
+
+	const uint32_t pivotX = static_cast<uint32_t>(std::min(std::max(pivot.x, 0.0f) * PIVOT_STEPS + 0.5f, 65535.0f));
+	const uint32_t pivotY = static_cast<uint32_t>(std::min(std::max(pivot.y, 0.0f) * PIVOT_STEPS + 0.5f, 65535.0f));
+
+	uint32_t packedTint = 0;
+
+	for (int channel = 0; channel < 4; ++channel)
+	{
+		const uint32_t value = static_cast<uint32_t>(std::min(std::max(tint[channel], 0.0f), 1.0f) * 255.0f + 0.5f);
+		packedTint |= value << (channel * 8);
+	}
+
+	return
+	{
+		packedRotation | (bFlipX ? SPRITE_STYLE_FLIP_X : 0u) | (bFlipY ? SPRITE_STYLE_FLIP_Y : 0u)
+		, pivotX | (pivotY << 16)
+		, packedTint
+		, 0u
+	};
+}
+
+glm::mat4 GetSpriteStyleTransform(const glm::uvec4& style, const glm::uvec4& textureAttribute)
+{
+	const glm::vec2 size = glm::max(GetSpriteStyleSize(style, textureAttribute), glm::vec2(1.0f));
+	const glm::vec2 pivot = glm::vec2(style.y & 0xFFFFu, style.y >> 16) / PIVOT_STEPS;
+	const float angle = static_cast<float>(style.x & 0xFFFFu) * (TWO_PI / ROTATION_STEPS);
+	const float cosine = std::cos(angle);
+	const float sine = std::sin(angle);
+
+	//  ǥ u R * ((u - pivot) * size) / size ϴ. ̴   մϴ.
+	glm::mat4 transform(1.0f);
+	transform[0] = glm::vec4(cosine, sine * size.x / size.y, 0.0f, 0.0f);
+	transform[1] = glm::vec4(-sine * size.y / size.x, cosine, 0.0f, 0.0f);
+	transform[3] = glm::vec4(-(transform[0].x * pivot.x + transform[1].x * pivot.y), -(transform[0].y * pivot.x + transform[1].y * pivot.y), 0.0f, 1.0f);
+
+	return transform;
+}
+
+glm::vec4 GetSpriteStyleTint(const glm::uvec4& style)
+{
+	return glm::vec4(style.z & 0xFFu, (style.z >> 8) & 0xFFu, (style.z >> 16) & 0xFFu, style.z >> 24) * (1.0f / 255.0f);
+}
+
+uint32_t GetSpriteStyleClipRect(const glm::uvec4& style)
+{
+	return style.x >> SPRITE_STYLE_CLIP_RECT_SHIFT;
+}
+
+void SetSpriteStyleClipRect(glm::uvec4* style, uint32_t clipRect)
+{
+	assert(style != nullptr && clipRect < MAX_CLIP_RECT_COUNT);
+
+	style->x = (style->x & ~SPRITE_STYLE_CLIP_RECT_MASK) | (clipRect << SPRITE_STYLE_CLIP_RECT_SHIFT);
+}
+
+glm::vec2 GetSpriteStyleSize(const glm::uvec4& style, const glm::uvec4& textureAttribute)
+{
+	const uint32_t width = style.w & 0xFFFFu;
+	const uint32_t height = style.w >> 16;
+
+	return glm::vec2(width != 0 ? width : textureAttribute.x, height != 0 ? height : textureAttribute.y);
+}
+
+void SetSpriteStyleSize(glm::uvec4* style, uint32_t width, uint32_t height)
+{
+	assert(style != nullptr && width <= 0xFFFFu && height <= 0xFFFFu);
+
+	style->w = width | (height << 16);
+}
+
+uint32_t GetSpriteStyleNineSliceBorder(const glm::uvec4& style)
+{
+	return (style.x & SPRITE_STYLE_NINE_SLICE_BORDER_MASK) >> SPRITE_STYLE_NINE_SLICE_BORDER_SHIFT;
+}
+
+void SetSpriteStyleNineSliceBorder(glm::uvec4* style, uint32_t border)
+{
+	assert(style != nullptr && border < MAX_NINE_SLICE_BORDER_COUNT);
+
+	style->x = (style->x & ~SPRITE_STYLE_NINE_SLICE_BORDER_MASK) | (border << SPRITE_STYLE_NINE_SLICE_BORDER_SHIFT);
+}
+
+SpriteTexCoordMapping GetSpriteTexCoordMapping(const glm::vec2& size, const glm::uvec4& textureAttribute, const NineSliceBorder& border)
+{
+	// SpriteVS.glsl   ؾ  迡  ؼ нϴ.
+	const glm::vec2 textureSize = glm::vec2(textureAttribute.x, textureAttribute.y);
+
+	//  ׵θ ؽó ũ ؽó °   Դϴ. ״ θ    Ǿ Ʈ  нϴ.
+	const glm::vec2 borderFit = glm::min(glm::vec2(1.0f), textureSize / glm::max(glm::vec2(border.Left, border.Bottom) + glm::vec2(border.Right, border.Top), glm::vec2(1.0f)));
+	const glm::vec2 low = glm::vec2(border.Left, border.Bottom) * borderFit;
+	const glm::vec2 high = glm::vec2(border.Right, border.Top) * borderFit;
+
+	// ũⰡ  ׵θ  ׵θ   ̰  ׸ ʽϴ.
+	const glm::vec2 shrink = glm::min(glm::vec2(1.0f), size / glm::max(low + high, glm::vec2(1.0f)));
+
+	SpriteTexCoordMapping mapping;
+	mapping.LowEnd = low * shrink;
+	mapping.HighOffset = textureSize - size;
+
+	for (int axis = 0; axis < 2; ++axis)
+	{
+		mapping.HighStart[axis] = shrink[axis] < 1.0f ? mapping.LowEnd[axis] : size[axis] - high[axis];
+
+		const float center = mapping.HighStart[axis] - mapping.LowEnd[axis];
+		mapping.CenterScale[axis] = center > 0.0f ? (textureSize[axis] - low[axis] - high[axis]) / center : 0.0f;
+	}
+
+	return mapping;
+}
+
+glm::vec2 MapSpriteTexCoord(const SpriteTexCoordMapping& mapping, const glm::vec2& coord)
+{
+	glm::vec2 texCoord;
+
+	for (int axis = 0; axis < 2; ++axis)
+	{
+		if (coord[axis] >= mapping.HighStart[axis])
+		{
+			texCoord[axis] = coord[axis] + mapping.HighOffset[axis];
+		}
+		else if (coord[axis] < mapping.LowEnd[axis])
+		{
+			texCoord[axis] = coord[axis];
+		}
+		else
+		{
+			texCoord[axis] = mapping.LowEnd[axis] + (coord[axis] - mapping.LowEnd[axis]) * mapping.CenterScale[axis];
+		}
+	}
+
+	return texCoord;
+}
+
+glm::uvec4 MakeSpritePointStyle(const glm::uvec4& style, uint32_t averageColor)
+{
+	assert((style.z >> 24) == 255 && "Point sprites must be opaque");
+
+	// äθ  8Ʈ  ϰ ݿøմϴ. νϽ  Ĵ 255̹Ƿ Ĵ   ״Դϴ.
+	uint32_t packedColor = 0;
+
+	for (int channel = 0; channel < 4; ++channel)
+	{
+		const uint32_t product = ((style.z >> (channel * 8)) & 0xFFu) * ((averageColor >> (channel * 8)) & 0xFFu);
+		packedColor |= ((product + 127) / 255) << (channel * 8);
+	}
+
+	return glm::uvec4(style.x, style.y, packedColor, style.w);
+}
+
+glm::vec4 GetSpritePointCenter(const glm::mat4& projectionViewWorld, const glm::uvec4& style, const glm::uvec4& textureAttribute)
+{
+	return projectionViewWorld * GetSpriteStyleTransform(style, textureAttribute) * glm::vec4(0.5f, 0.5f, 0.0f, 1.0f);
+}
+
+float GetSpritePointSize(const glm::mat4& projectionViewWorld, const glm::uvec4& style, const glm::vec2& viewportSize)
+{
+	// SpritePointVS.glsl  ProjectionViewWorld    ̸ ȼ ٲߴϴ.
+	const float determinant = projectionViewWorld[0].x * projectionViewWorld[1].y - projectionViewWorld[1].x * projectionViewWorld[0].y;
+	const float area = std::abs(determinant) * viewportSize.x * viewportSize.y * 0.25f;
+	const float coverage = static_cast<float>(style.z >> 24) * (1.0f / 255.0f);
+
+	return std::max(std::sqrt(area * coverage), 1.0f);
+}
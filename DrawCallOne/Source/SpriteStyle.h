@@ -0,0 +1,91 @@
+#pragma once
+
+/*
+	νϽ ȸ, , ǹ, , ũ⸦ 16Ʈ  Դϴ. SpriteVS.glsl  Ģ Ǳϴ.
+	ProjectionViewWorld ״ ġ ũ⸸ ,    ̴ ϹǷ ȸϰų  ٲ Ʈ  νϽ ׸ϴ.
+
+	x: 0~15Ʈ ݽð  ȸ(  65536), 16Ʈ  , 17Ʈ  , 18~23Ʈ  ̽ ׵θ ȣ, 24~31Ʈ Ŭ 簢 ȣԴϴ.
+	y: 0~15Ʈ ǹ , 16~31Ʈ  ġԴϴ. Ʈ ũ 1/32768  0.0, 0.5, 1.0 Ȯϰ ǥ˴ϴ.
+	z: RGBA8 Դϴ.   Ʒ Ʈ̸ Ƽ  Բ ؼ  ϴ.
+	w: 0~15Ʈ , 16~31Ʈ  ũ(ȼ)Դϴ. 0̸ ؽó ũԴϴ. ProjectionViewWorld  ũ ÷ ˴ϴ.
+
+	Ʈ ġ ǹ ̴ ̸ ȸ ǹ ߽ մϴ.  ؽó Ƿ Ʈ ϴ ڸ ٲ ʽϴ.
+
+	Ŭ 簢 ȣ UploadClipRects ø ǥ ȣ̸ 0̸ ڸ ʽϴ.
+	ȸ  Ʈ  ̴ 簢 ؽó ǥ Բ ̰, ȸ Ʈ ׸Ʈ ̴ 簢  ϴ.
+
+	ũ⸦ ٲ Ʈ ؽó þ,  ̽ ׵θ ϸ ׵θ ؼ ũ ״ ΰ  þϴ.
+	׵θ ȣ UploadNineSliceBorders ø ǥ ȣ̸, ũⰡ ׵θ  ׵θ    ŭ ׸ϴ.
+
+	 ȼۿ  ʴ Ʈ ؽó  ʰ  ϳ ׸  ֽϴ(SpritePointVS.glsl).
+	 ׸ νϽ z ؽó    ̰ Ĵ ؽó  ̸, 簢   ̸  簢 ׸ϴ.
+*/
+
+#include <cstdint>
+
+#include <glm/glm.hpp>
+
+#include "RenderBackend.h"
+
+static constexpr uint32_t SPRITE_STYLE_FLIP_X = 1u << 16;
+static constexpr uint32_t SPRITE_STYLE_FLIP_Y = 1u << 17;
+static constexpr uint32_t SPRITE_STYLE_NINE_SLICE_BORDER_SHIFT = 18;
+static constexpr uint32_t SPRITE_STYLE_NINE_SLICE_BORDER_MASK = 0x3Fu << SPRITE_STYLE_NINE_SLICE_BORDER_SHIFT;
+static constexpr uint32_t SPRITE_STYLE_CLIP_RECT_SHIFT = 24;
+static constexpr uint32_t SPRITE_STYLE_CLIP_RECT_MASK = 0xFFu << SPRITE_STYLE_CLIP_RECT_SHIFT;
+
+/*
+	Ʈ ũ ǥ(ȼ) ؽó ǥ(ؼ) ٲٴ  1 ԼԴϴ. SpriteFS.glsl  Ģ մϴ.
+	LowEnd  ״, HighStart ̸̻ HighOffset ϰ,  ̴ LowEnd CenterScale øϴ.
+*/
+struct SpriteTexCoordMapping
+{
+	glm::vec2 LowEnd;
+	glm::vec2 HighStart;
+	glm::vec2 HighOffset;
+	glm::vec2 CenterScale;
+};
+
+// ȸ ʰ   ǹ  Ʒ̰  ũ⸦ ٲ ʴ Դϴ.
+static const glm::uvec4 DEFAULT_SPRITE_STYLE = { 0u, 0u, 0xFFFFFFFFu, 0u };
+
+// rotation  Դϴ. pivot 0~2, tint 0~1  ߸ϴ. Ŭ 簢, ׵θ ȣ ũ 0Դϴ.
+glm::uvec4 PackSpriteStyle(float rotation, const glm::vec2& pivot, bool bFlipX, bool bFlipY, const glm::vec4& tint);
+
+/*
+	0~1  ǥ ǹ ȸ ϴ Դϴ. ProjectionViewWorld ڿ ϸ ̴ ϴ  ġ ϴ.
+	ȸ ȼ  ؾ μ  ǹǷ Ʈ ũⰡ ʿϰ, ũ⸦  ʾ ؽó ũ(textureAttribute x, y) մϴ.
+*/
+glm::mat4 GetSpriteStyleTransform(const glm::uvec4& style, const glm::uvec4& textureAttribute);
+
+glm::vec4 GetSpriteStyleTint(const glm::uvec4& style);
+
+uint32_t GetSpriteStyleClipRect(const glm::uvec4& style);
+
+// clipRect MAX_CLIP_RECT_COUNT ۾ƾ ˴ϴ.   ״ Ӵϴ.
+void SetSpriteStyleClipRect(glm::uvec4* style, uint32_t clipRect);
+
+// ׷ ũ(ȼ)Դϴ. ũ⸦    ؽó ũԴϴ.
+glm::vec2 GetSpriteStyleSize(const glm::uvec4& style, const glm::uvec4& textureAttribute);
+
+// 0̸ ؽó ũ ǵϴ. 65535 Ŭ  ϴ.
+void SetSpriteStyleSize(glm::uvec4* style, uint32_t width, uint32_t height);
+
+uint32_t GetSpriteStyleNineSliceBorder(const glm::uvec4& style);
+
+// border MAX_NINE_SLICE_BORDER_COUNT ۾ƾ ˴ϴ. 0̸  ̽ ϴ.
+void SetSpriteStyleNineSliceBorder(glm::uvec4* style, uint32_t border);
+
+// ׵θ  border  0 ѱϴ. ũⰡ ؽó  ׵θ  ٲ ʴ ԼԴϴ.
+SpriteTexCoordMapping GetSpriteTexCoordMapping(const glm::vec2& size, const glm::uvec4& textureAttribute, const NineSliceBorder& border);
+
+glm::vec2 MapSpriteTexCoord(const SpriteTexCoordMapping& mapping, const glm::vec2& coord);
+
+//  ׸ νϽ ŸԴϴ. averageColor ؽó  (RGBA8)̸ İ  Դϴ. νϽ  Ĵ 255 ˴ϴ.
+glm::uvec4 MakeSpritePointStyle(const glm::uvec4& style, uint32_t averageColor);
+
+// ǹ ȸ  簢 Դϴ. ȭ ġ ǥ̸   ġ ϴ.
+glm::vec4 GetSpritePointCenter(const glm::mat4& projectionViewWorld, const glm::uvec4& style, const glm::uvec4& textureAttribute);
+
+//    ȼ Դϴ. 簢 ̿ Ÿ  ĸ  ̸ 1ȼ  ʽϴ. ȸص ̴ ϴ.
+float GetSpritePointSize(const glm::mat4& projectionViewWorld, const glm::uvec4& style, const glm::vec2& viewportSize);
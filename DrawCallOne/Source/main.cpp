@@ -27,9 +27,33 @@
 #include <list>
 #include <unordered_map>
 #include <chrono>
-#include <Windows.h>
+#include <algorithm>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <map>
+#include <set>
+#include <mutex>
+#include <condition_variable>
+#include <sys/stat.h>
 
-#include <GLFW/glfw3.h>
+#ifdef _WIN32
+	#include <Windows.h>
+#endif
+
+#ifdef __linux__
+	#include <sys/inotify.h>
+	#include <unistd.h>
+#endif
+
+// HEADLESS_BUILD ϸ GLFW  --headless --software   ֽϴ.  CIó â    ȯ濡 մϴ.
+#ifndef HEADLESS_BUILD
+	#include <GLFW/glfw3.h>
+#else
+	struct GLFWwindow;
+#endif
+
+#include <EGL/egl.h>
 #include <GLES3/gl31.h>
 #include <GLES2/gl2ext.h>
 #include <GLES3/gl3platform.h>
@@ -38,6 +62,28 @@
 #include <glm/gtc/type_ptr.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 
+#include "AstcDecoder.h"
+#include "Etc2Encoder.h"
+#include "Ktx2Reader.h"
+#include "GpuMemory.h"
+#include "JobPool.h"
+#include "RadixSort.h"
+#include "FramePacer.h"
+#include "GlStateCache.h"
+#include "GlCall.h"
+#include "RenderBackend.h"
+#include "NullRenderBackend.h"
+#include "SoftwareRenderBackend.h"
+#include "SpriteStyle.h"
+
+// Ե gl2ext.h KHR_parallel_shader_compile Ƿ  մϴ.
+#ifndef GL_KHR_parallel_shader_compile
+	#define GL_KHR_parallel_shader_compile 1
+	#define GL_MAX_SHADER_COMPILER_THREADS_KHR 0x91B0
+	#define GL_COMPLETION_STATUS_KHR 0x91B1
+	typedef void (GL_APIENTRYP PFNGLMAXSHADERCOMPILERTHREADSKHRPROC) (GLuint count);
+#endif
+
 /*** Namespaces ***/
 using namespace std;
 using namespace glm;
@@ -48,12 +94,200 @@ struct Sprite
 	std::string ImagePath;
 	float X;
 	float Y;
+	uint16_t MaterialID;
+	uint32_t CacheLayer; // UNCACHED_LAYER̸ ĳ ʰ   ׸ϴ.
+	uvec4 Style; // ȸ, , ǹ, , ũ⸦  Դϴ. SetSpriteStyle, SetSpriteSize  ٲߴϴ.
+};
+
+enum MaterialLayer
+{
+	MATERIAL_LAYER_WORLD,
+	MATERIAL_LAYER_UI, // 带  ׸ ڿ  ˻  ׸ϴ.
+};
+
+/*
+	Ʈ ׸  ʿ  Դϴ. Ʈ Ƽ ȣ  ֽϴ.
+	̴  ׽Ʈ( )     н   մϴ.
+*/
+struct Material
+{
+	GLuint ShaderProgram;
+	GLuint OpaqueShaderProgram;
+	GLuint TextureArray;
+	MaterialBlendMode BlendMode;
+	MaterialLayer Layer;
+	vec4 Tint; // ؼ  ϴ.
+};
+
+//   ƼԴϴ. GL ´ GlStateCache ϰ ⼭  ٽ  Ǵմϴ.
+struct RenderState
+{
+	GLuint ShaderProgram;
+	int MaterialID; // ƾƮ    ƼԴϴ.
+};
+
+//  尡 ׸ νϽ  ϳԴϴ.
+struct DrawCommand
+{
+	uint32_t CacheLayer;
+	uint16_t MaterialID;
+	SpriteBlendMode Pass;
+	bool bPointSprites;
+	GLsizei FirstInstance;
+	GLsizei InstanceCount;
+};
+
+/*
+	ùķ̼ 尡   忡 ѱ   з Դϴ.
+	ѱ ڿ  尡     ùķ̼ 尡 ǵ帮 ʽϴ.
+*/
+struct FramePacket
+{
+	unique_ptr<mat4[]> ProjectionViewWorlds; // ̴  PVW Դϴ.
+	unique_ptr<uvec4[]> TextureAttributes; // ̴  ؽó Ӽ Դϴ.
+	unique_ptr<uvec4[]> SpriteStyles; // ̴  ȸ,    Դϴ.
+	unique_ptr<uint32_t[]> SpriteIndices; // νϽ  Ʈ մϴ. ٲ  ã  մϴ.
+	std::vector<DrawCommand> DrawCommands;
+	uint64_t CacheLayerVersions[CACHED_LAYER_COUNT]; // ĳ ̾ Ʈ ؽó ٲ ޶ϴ.
+	uint64_t TextureGeneration;
+	ScreenRect ClipRects[MAX_CLIP_RECT_COUNT]; // νϽ SpriteStyle Ŭ ȣ մϴ. 0  ʽϴ.
+	uint32_t ClipRectCount;
+	NineSliceBorder NineSliceBorders[MAX_NINE_SLICE_BORDER_COUNT]; // νϽ SpriteStyle ׵θ ȣ մϴ. 0  ʽϴ.
+	uint32_t NineSliceBorderCount;
+};
+
+//  ε尡 ٲ ؽó  ã  ص  Դϴ.
+struct TextureFileState
+{
+	uint64_t Size;
+	uint64_t ContentHash;
+};
+
+//  尡  ׸ Ʈ ϳ ȭ  ׸ Դϴ. ϳ ٲ    ٽ ׸ϴ.
+struct SpriteFootprint
+{
+	ScreenRect Bounds;
+	uvec4 TextureAttribute;
+	uvec4 Style;
+	uint32_t CacheLayer;
+	uint16_t MaterialID;
+	SpriteBlendMode Pass;
+	bool bPointSprite;
+	bool bDrawn;
+};
+
+struct DirtyRectStats
+{
+	uint32_t FrameCount;
+	uint32_t PartialFrameCount; // ٲ  ٽ ׸  Դϴ.
+	uint64_t RedrawnPixelCount; // ü ׸  ؼ ٽ ׸ ȼ Դϴ.
+};
+
+struct RenderThreadFrameStats
+{
+	uint32_t RenderedFrameCount;
+	double RenderTime; // Render  ð (и)Դϴ.
+};
+
+struct DynamicResolutionStats
+{
+	uint32_t SampleCount; // GPU ð   Դϴ.
+	double TotalGpuFrameTime; // и Դϴ.
+	uint32_t LoweredCount;
+	uint32_t RaisedCount;
+	uint32_t ProbeCount; // ø  ִ ȮϷ ȭ ü ٽ ׸ ȽԴϴ.
+	float MinRenderScale; // ̹    Ҵ Դϴ.
+};
+
+// GL_EXT_disjoint_timer_query  潺   ϴ.  ٸ ʵ   ϴ.
+struct GpuFrameTimer
+{
+	GLuint Query;
+	GLsync Fence; // Ÿ̸      ֽϴ.
+	uint64_t FrameNumber; // 潺     潺 ã  մϴ.
+	std::chrono::steady_clock::time_point BeginTime; //      ðԴϴ.
+	std::chrono::steady_clock::time_point UnsignaledTime; // 潺  ȣ    Ȯ ðԴϴ.
+	float RenderScale; //   ػ Դϴ.
+	bool bFullFrame;
+	bool bPending; //    ʾҽϴ.
+};
+
+struct IdleFrameStats
+{
+	uint32_t SkippedFrameCount; //  ٲ ʾ  Ŷ    Դϴ.
+	uint32_t IdleWakeCount; //  󵵷   Ȯ ȽԴϴ.
+};
+
+struct TextureAttribute
+{
+	uint32_t Width;
+	uint32_t Height;
+	uint32_t OffsetX; // 4    ؽó  Դϴ. Ʈ  1/4Դϴ.
+
+	// ҷ  ؼ ĸ ˻ؼ ϸ ׸  ̴ ޶ϴ.
+	SpriteBlendMode BlendMode;
+
+	//  ׸  ϴ RGBA8 Դϴ.  ķ  ̰ Ĵ  ( )Դϴ.
+	uint32_t AverageColor;
+
+	// ̴ Ѱ νϽ ӼԴϴ. , ,  x,   ̸ ؽó ҷ    մϴ.
+	//  ȣ floatδ 2^24  Ȯ Ƿ  ѱϴ.
+	uvec4 InstanceAttribute;
 };
 
 struct AstcFile
 {
 	size_t size;
 	FILE* data;
+	size_t dataIndex; // ̹ ۿ Ͱ  ġԴϴ.
+};
+
+struct Ktx2Image
+{
+	Ktx2File File;
+	uint32_t Layer;
+	uint32_t Level;
+	size_t DataSize;
+	size_t DataIndex; // ̹ ۿ Ͱ  ġԴϴ.
+};
+
+// ؽó ̿ ø Ϳ   ؽó ӼԴϴ.  ε ٽ    ¸ ٲ ʰ ⿡  ڿ ٲߴϴ.
+struct TextureAtlas
+{
+	unordered_map<string, TextureAttribute> TextureAttributes;
+	unique_ptr<uint8_t[]> ImageData; // TextureArrayFormat ȯ Դϴ.
+	GLsizei Depth;
+	size_t UsedDataSize;
+};
+
+struct TextureArrayCacheHeader
+{
+	char Magic[4];
+	uint32_t Format;
+	uint64_t SourceHash;
+	uint64_t DataSize;
+};
+
+struct ProgramBinaryCacheHeader
+{
+	char Magic[4];
+	uint32_t BinaryFormat; // glGetProgramBinary  ̹  Դϴ.
+	uint64_t ProgramHash;
+	uint64_t BinarySize;
+};
+
+/*
+	̳ ũ   Ȯ  ̴ α׷Դϴ.
+	Ȯϴ  ̹ ߹Ƿ ó ׸  ٴ      ̷ϴ.
+*/
+struct ShaderProgramBuild
+{
+	GLuint ShaderProgram;
+	GLuint VertexShader; // ĳõ ̳ʸ ҷ 0Դϴ.
+	GLuint FragmentShader;
+	uint64_t ProgramHash;
+	string VertexShaderSource; // ̳ʸ źεǾ  ٽ ϱ  մϴ.
+	string FragmentShaderSource;
 };
 
 struct AstcHeader
@@ -71,60 +305,471 @@ struct AstcHeader
 static constexpr int SCREEN_WIDTH = 1280;
 static constexpr int SCREEN_HEIGHT = 720;
 
+// ùķ̼ 尡  Ŷ  Դϴ. VSYNC Ѹ ȭ鿡 ǥõǴ 󵵴  ֻ ϴ.
+static constexpr double TARGET_FRAME_RATE = 60.0;
+static constexpr bool VSYNC = true;
+
+//  ð 踦 ϴ ()Դϴ.
+static constexpr double FRAME_STATS_REPORT_INTERVAL = 5.0;
+
+/*
+	Ʈ, ī޶, ؽó ٲ   Update ǳʶٰ  Ŷ  ʽϴ.
+	   Ŷ  ׸  Ƿ ȭ鿡  ̹ ״ ϴ.
+	ٲ  ° IDLE_ENTER_DELAY ̾    IDLE_FRAME_RATEθ  Ȯϸ, Է ̺Ʈ  ٷ ϴ.
+*/
+static constexpr bool IDLE_FRAME_SKIPPING = true;
+static constexpr double IDLE_FRAME_RATE = 10.0;
+static constexpr double IDLE_ENTER_DELAY = 0.5;
+
+// --headless, --software   ùķ̼  Դϴ.
+static constexpr int HEADLESS_FRAME_COUNT = 600;
+
+// κ丮ó UI Ʈ ߶ ִ ũ Դϴ. â 콺 ٷ ù ° 並 Ʒ űϴ.
+static constexpr uint32_t SCROLL_VIEW_COUNT = 4;
+static constexpr int32_t SCROLL_VIEW_WHEEL_STEP = 20; //   ĭ ̴ ȼ Դϴ.
+static constexpr int HEADLESS_SCROLL_PERIOD = 120; // --headless, --software ù ° 䰡  ȼ  ö  Դϴ.
+
+// --software     ϴ ⺻ Դϴ. ҽ   ʵ ĳ  մϴ.
+static constexpr char SOFTWARE_FRAME_DIRECTORY[] = "Cache/";
+static constexpr char SOFTWARE_FRAME_FILE_PATH[] = "Cache/SoftwareFrame.tga";
+
 // Ʈ     CPU 뷮 GPU 90%  Ʈ   CPU 뷮 ̸ Ȯ 
 // Ȥ     Ϸ ̿  ֽϴ.
 // ⼭   Release    ׽Ʈ ϼž ˴ϴ.
 static constexpr int SPRITE_COUNT = 1000;
 
+// Ʈ  Ű Ŀ  Ʒ Ʈ Դϴ. Ű  Update ϼ.
+static constexpr int SPRITE_SORT_KEY_BIT_COUNT = 23;
+
+// --sort-benchmark  ׸ , Ƽ   ݺ ȽԴϴ.
+static constexpr int SORT_BENCHMARK_ITEM_COUNT = 200000;
+static constexpr int SORT_BENCHMARK_MATERIAL_COUNT = 8;
+static constexpr int SORT_BENCHMARK_RUN_COUNT = 100;
+
+// ؽó    ũԴϴ. ASTC 4x4  16Ʈ̹Ƿ ؼ ϳ 1Ʈ մϴ.
+static constexpr GLsizei TEXTURE_ARRAY_WIDTH = 512;
+static constexpr GLsizei TEXTURE_ARRAY_HEIGHT = 512;
+static constexpr GLsizei TEXTURE_ARRAY_AREA = TEXTURE_ARRAY_WIDTH * TEXTURE_ARRAY_HEIGHT;
+static constexpr size_t ASTC_BLOCK_SIZE = 16;
+
+// SpriteFS.glsl İ 0.05  ؼ ϴ.  ؼ İ   ̸̻  ؼ ϴ.
+static constexpr uint8_t ALPHA_TEST_THRESHOLD = 13;
+
+//  ؼ(ε巯 ڸ, ̵ ) ִ Ʈ ڿ   Ͽ   ׸ϴ.
+// İ ALPHA_TEST_THRESHOLD ̻ OPAQUE_ALPHA_THRESHOLD ̸ ؼ  ϴ.
+//   ؼ ϰ ׷ϴ.
+static constexpr bool SPRITE_ALPHA_BLENDING = true;
+static constexpr uint8_t OPAQUE_ALPHA_THRESHOLD = 250;
+
+// ⺻  δ ƼԴϴ. ȣ Materials  ϴ.
+static constexpr uint16_t MATERIAL_DEFAULT = 0;
+static constexpr uint16_t MATERIAL_ADDITIVE = 1;
+static constexpr uint16_t MATERIAL_TINTED = 2;
+static constexpr uint16_t MATERIAL_UI = 3;
+
+/*
+	 ʴ Ʈ ĳ ̾   ׷ΰ  ӿ ̾ ռ մϴ.
+	ĳ ̾ ĳ   Ʈ (Ʒ) ռǹǷ ó ڿ ִ Ʈ ־ ˴ϴ.
+	 Ʈ  Ƿ  Ʈ  ְ UI   ׸ϴ.
+*/
+static constexpr bool CACHE_STATIC_WORLD = true;
+static constexpr uint32_t CACHE_LAYER_WORLD = 0;
+static constexpr uint32_t UNCACHED_LAYER = CACHED_LAYER_COUNT; //  Ű ĳ ̾ ڿ   ū Դϴ.
+
+/*
+	ָ ؼ  ó ȭ鿡 μ  POINT_SPRITE_LOD_SIZE ȼ  Ʈ 簢   ϳ ׸ϴ.
+	 ؽó  ʰ ؽó   ä,  Ƽ      ׸ϴ.
+	Ƽ̳ νϽ    Ʈ ׸  ٲ  , ߸ Ʈ  ̴ ڸ Ƿ 簢 ׸ϴ.
+*/
+static constexpr bool POINT_SPRITE_LOD = true;
+static constexpr float POINT_SPRITE_LOD_SIZE = 4.0f;
+
+/*
+	 Ӱ ؼ ̰ų, Ÿų, ų, ؽó ٲ Ʈ  ٽ ׸ϴ.
+	ȭ  Ǵ  ۿ ׸  ⺻  ۷ ϰ, ٲ      ģ νϽ ׸ϴ.
+	ٲ  MAX_DIRTY_RECT_COUNT    þ ̰   ͳ Ĩϴ.
+*/
+static constexpr bool DIRTY_RECT_REDRAW = true;
+static constexpr size_t MAX_DIRTY_RECT_COUNT = 4;
+static constexpr double DIRTY_RECT_MAX_AREA_RATIO = 0.5; // ٽ ׸ ̰ ȭ鿡    ü ׸  ϴ.
+
+/*
+	GPU   ׸ ð 缭   ȭ麸  ػ󵵷 ׸,    ȭ ũ ÷ մϴ.
+	 ׸ Ʈ ڱ  ʷƮ ڶ Ⱑ  ġ   ϴ.
+	GL_EXT_disjoint_timer_query  Ÿ̸  ,     潺 ٸ ʰ  ӵ鿡 Ȯմϴ.
+	潺 ȣ ð ˷ Ƿ Ȯ ð GPU ð  ϰ,   Ʒ, ø    Ǵմϴ.
+	ٲ  ׸  ξ Ƿ ø  ̾   ü ӵ  ־ մϴ.
+	  缭 ü    RENDER_SCALE_PROBE_INTERVAL Ӹ   ü ٽ ׷ ϴ.  ٲ ȭ ü ٽ ׸ϴ.
+*/
+static constexpr bool DYNAMIC_RESOLUTION = true;
+static constexpr float MIN_RENDER_SCALE = 0.5f;
+static constexpr float RENDER_SCALE_STEP = 0.05f;
+static constexpr double GPU_FRAME_TIME_BUDGET = 0.85 / TARGET_FRAME_RATE; //  Դϴ. CPU ҿ   ϴ.
+static constexpr double RENDER_SCALE_RAISE_RATIO = 0.8; //  ܰ ÷   ð    ۾ƾ øϴ.
+static constexpr uint32_t RENDER_SCALE_RAISE_DELAY = 30; //  ִ  ̸ŭ ̾ øϴ.
+static constexpr uint32_t RENDER_SCALE_PROBE_INTERVAL = 15; // ȮϷ ٽ ׸ ü     ̸ŭ  ٽ ׸ϴ.
+static constexpr double GPU_FRAME_TIME_SMOOTHING = 0.25; //  ð  ̵   Դϴ.
+static constexpr uint32_t GPU_FRAME_TIMER_COUNT = 4;
+static constexpr double GPU_FENCE_POLL_INTERVAL = 0.001; //  Դϴ.  Ŷ ٸ  潺 Ȯϴ Դϴ.
+
+// Resources  Ͽ  ASTC  α׷  ʰ ٽ ҷɴϴ.
+// Ʈ ۾ ݺ  ϸ ⺻    ϴ.
+#ifdef _DEBUG
+static constexpr bool TEXTURE_HOT_RELOAD = true;
+#else
+static constexpr bool TEXTURE_HOT_RELOAD = false;
+#endif
+
+static constexpr char RESOURCE_DIRECTORY[] = "Resources/";
+
+// ASTC  ʴ ⿡ ؽó ̸ Ʒ  ȯؼ մϴ.
+// GL_COMPRESSED_RGBA8_ETC2_EAC  ػ󵵷, GL_RGBA8 ޸𸮸 Ƴ     ػ󵵷 ϴ.
+//     ϳ 16Ʈ̹Ƿ (ETC2 4x4 , RGBA8 2x2 ؼ) ؽó  ״   ֽϴ.
+static constexpr GLenum FALLBACK_TEXTURE_FORMAT = GL_COMPRESSED_RGBA8_ETC2_EAC;
+
+//  ȯ  etc2 Ǵ rgba8 ϸ ASTC ص   ȯմϴ. ٽ  ʰ CI ȯ θ Ȯ  մϴ.
+static constexpr char TEXTURE_FORMAT_ENVIRONMENT_VARIABLE[] = "DRAWCALLONE_TEXTURE_FORMAT";
+
+// ȯ   ؽÿ ˺   Ǿ  ʹ ȯ ʽϴ.
+static constexpr char TEXTURE_CACHE_DIRECTORY[] = "Cache/";
+
+// ũ ̴ α׷ ̳ʸ ϴ Դϴ.  ʹ ϰ ũ ǳʶݴϴ.
+static constexpr char PROGRAM_CACHE_DIRECTORY[] = "Cache/";
+static constexpr uint64_t MAX_PROGRAM_BINARY_SIZE = 16 * 1024 * 1024; // ջ ĳ  ū ޸𸮸  ʵ ̺ ũ մϴ.
+
+//  ⸦    ޸ Դϴ.   մϴ.
+static constexpr size_t GPU_MEMORY_BUDGET = 32 * 1024 * 1024;
+
 static const mat4 PROJECTION_VIEW = 
 	ortho(0.0f, static_cast<float>(SCREEN_WIDTH), 0.0f, static_cast<float>(SCREEN_HEIGHT), 1.0f, -(float)SPRITE_COUNT)
 	* translate(mat4(1.0f), vec3(0.0f, 0.0f, 0.0f));
 
 /*** Global Variables ***/
-static GLuint ShaderProgram = 0;
+static GLuint ShaderProgram = 0; //  ׽Ʈ(discard) ϴ ̴Դϴ.
+static GLuint OpaqueShaderProgram = 0; //  Ʈ ̴ discard  early-Z ۵մϴ.
 static GLuint VAO = 0;
 static GLuint VBO = 0;
 static GLuint EBO = 0;
 static GLuint ProjectionViewWorldVBO = 0;
 static GLuint TextureAttributeVBO = 0;
+static GLuint SpriteStyleVBO = 0;
 static GLuint TextureArray = 0;
+static GLsizei TextureArrayDepth = 0; // ؽó   Դϴ.
+static GLenum TextureArrayFormat = GL_COMPRESSED_RGBA_ASTC_4x4_KHR; // ؽó ̿  ϴ Դϴ.
+static size_t UsedTextureArrayDataSize = 0; // ؽó ̿   Ʈ Դϴ.
+static GLuint CompositeShaderProgram = 0; // ĳ ̾ ȭ鿡 ռϴ ̴Դϴ.
+static GLuint PointShaderProgram = 0; //  Ʈ  ׸ ̴Դϴ. ؽó  Ƿ  Ƽ Բ մϴ.
+static float PointSpriteLodSize = POINT_SPRITE_LOD_SIZE; // GLES 鿣 ̹ ִ  ũ⸦  ʰ Դϴ.
+static GLuint LayerFramebuffers[CACHED_LAYER_COUNT] = {}; // ĳ ̾ ó ׸  ϴ.
+static GLuint LayerTextures[CACHED_LAYER_COUNT] = {};
+static GLuint LayerDepthRenderbuffer = 0; // ̾ ϳ ׸Ƿ  ۴ Բ մϴ.
+static GLuint SceneFramebuffer = 0; //    ְ  ػ󵵷ε ׸  ִ ȭԴϴ. 0̸ ⺻  ۿ ٷ ׸ϴ.
+static GLuint SceneColorRenderbuffer = 0;
+static GLuint SceneDepthRenderbuffer = 0;
+
+//  SceneFramebuffer  Ʒ RenderWidth x RenderHeight ׸ϴ.  常 մϴ.
+static float RenderScale = 1.0f;
+static GLsizei RenderWidth = SCREEN_WIDTH;
+static GLsizei RenderHeight = SCREEN_HEIGHT;
+static double SmoothedGpuFrameTime = 0.0; //  ̸   ȯ Դϴ. 0̸    ϴ.
+static uint32_t RenderScaleHeadroomFrameCount = 0; //  ܰ ÷  ־  ̾ Դϴ.
+static bool bRenderScaleFullFrameHeadroom = false; //  ̾    ü ӵ  ־ϴ.
+static uint32_t RenderScaleProbeFrameCount = RENDER_SCALE_PROBE_INTERVAL; //  ü ٽ ׸     Դϴ.
+static bool bGpuTimerQuerySupported = false;
+static PFNGLGETQUERYOBJECTUI64VEXTPROC GlGetQueryObjectui64vEXT = nullptr;
+static GpuFrameTimer GpuFrameTimers[GPU_FRAME_TIMER_COUNT] = {};
+static uint32_t GpuFrameTimerIndex = 0; //   ̸  ٸ     Դϴ.
+static bool bGpuFrameTimerActive = false; // ̹   ֽϴ.
+static uint64_t GpuFrameNumber = 0; //   ӵ ϴ.
+static uint64_t GpuFenceSignaledFrameNumber = 0; //  ȣ 潺 ̸,  潺 Ʒ  ð ̿ ȣǾϴ.
+static std::chrono::steady_clock::time_point GpuFenceSignaledAfter;
+static std::chrono::steady_clock::time_point GpuFenceSignaledBefore;
+static DynamicResolutionStats ResolutionStats = { 0, 0.0, 0, 0, 0, 1.0f };
+
+static const RenderBackend* Backend = nullptr; // â  GLES 鿣, 帮 忡  Ǵ Ʈ 鿣Դϴ.
+static const char* SoftwareFrameFilePath = SOFTWARE_FRAME_FILE_PATH;
 
 static Sprite Sprites[SPRITE_COUNT]; // ̹ , ġ մϴ.
-static unordered_map<string, uvec3> TextureAttributes; // ߺ  ؽó Ӽ մϴ.
-static unique_ptr<vec3[]> TextureAttributeBuffer = nullptr; // ̴  ؽó Ӽ Դϴ.
-static unique_ptr<mat4[]> ProjectionViewWorldBuffer = nullptr; // ̴  PVW Դϴ.
+static unordered_map<string, TextureAttribute> TextureAttributes; // ߺ  ؽó Ӽ մϴ.
+static std::mutex TextureAttributesMutex; //  ε尡 ؽó Ӽ ٲٴ  ùķ̼ 尡  ʵ ϴ.
+static uint64_t TextureGeneration = 0; //  ε ؽó ٲ  øϴ. TextureAttributesMutex ȣմϴ.
+static unique_ptr<const TextureAttribute*[]> SpriteTextureAttributes = nullptr; // Ӹ Ʈ ؽó Ӽ   ã  Դϴ.
+static unique_ptr<RadixSortItem[]> SpriteSortItems = nullptr; // Ʈ  Ű ȣԴϴ.
+static unique_ptr<RadixSortItem[]> SpriteSortScratch = nullptr;
+
+static vector<ShaderProgramBuild> PendingShaderPrograms;
+static bool bParallelShaderCompileSupported = false;
+static GLint TexelShift = 0; // ؽó  ũ⸦  Դϴ. ̴ α׷ غǸ  մϴ.
+
+static vector<Material> Materials;
+static RenderState CurrentRenderState;
+
+// ũ ó Ʈ ߶ ׸ 簢Դϴ. ùķ̼ 常 ϸ 0 ڸ ʴ´ٴ  Ӵϴ.
+static ScreenRect ClipRects[MAX_CLIP_RECT_COUNT] = {};
+static uint32_t ClipRectCount = 1;
+static uint32_t ScrollViewClipRects[SCROLL_VIEW_COUNT] = {};
+static vec4 UploadedClipRects[MAX_CLIP_RECT_COUNT] = {}; // GLES 鿣尡  ۿ  ø Դϴ.
+static GLuint ClipRectUBO = 0;
+
+// ũ⸦ ٲ㵵 þ ʴ г ׵θԴϴ. ùķ̼ 常 ϸ  ڿ ٲ ʽϴ.
+static NineSliceBorder NineSliceBorders[MAX_NINE_SLICE_BORDER_COUNT] = {};
+static uint32_t NineSliceBorderCount = 1;
+static vec4 UploadedNineSliceBorders[MAX_NINE_SLICE_BORDER_COUNT] = {};
+static GLuint NineSliceBorderUBO = 0;
+
+static uint64_t CacheLayerVersions[CACHED_LAYER_COUNT] = {}; // ùķ̼ 常 մϴ. ̾ Ʈ ٲ  øϴ.
+static uint64_t RenderedCacheLayerVersions[CACHED_LAYER_COUNT] = {}; //  常 մϴ. 鿣 ̾ ׷ Դϴ.
+
+//  ٲ Ȯϴ  մϴ. ùķ̼ 常 մϴ.
+static uint64_t SceneGeneration = 1; // Ʈ ī޶ ٲ  øϴ. ó   ٲ  ϴ.
+static uint64_t UpdatedSceneGeneration = 0; //   Ŷ   Դϴ.
+static uint64_t UpdatedTextureGeneration = 0;
+
+//    ǳʶٴ  â   մϴ.
+#ifndef HEADLESS_BUILD
+static IdleFrameStats IdleStats = {};
+
+//  缭 ùķ̼ 尡  ̼  ̺Ʈ ٸ  ִ Ÿϴ. ùķ̼ 常 մϴ.
+static bool bSceneIdle = false;
+#endif
+
+// ٲ  ã   ģ νϽ   մϴ.  常 մϴ.
+static unique_ptr<SpriteFootprint[]> SpriteFootprints = nullptr; // Ʈ ȣ Դϴ.
+static unique_ptr<bool[]> bSpritesPreviouslyDrawn = nullptr; // FindDirtyRects  ӿ ׸ Ʈ صδ Դϴ. Ʈ ȣ Դϴ.
+static bool bSpriteFootprintsValid = false; //  ̶ ȭ ü ׷ȴ Ÿϴ.
+static uint64_t RenderedTextureGeneration = 0;
+static vector<ScreenRect> DirtyRects;
+static unique_ptr<mat4[]> CulledProjectionViewWorlds = nullptr;
+static unique_ptr<uvec4[]> CulledTextureAttributes = nullptr;
+static unique_ptr<uvec4[]> CulledSpriteStyles = nullptr;
+static uint32_t CulledInstanceCount = 0;
+static vector<DrawCommand> CulledDrawCommands;
+static vector<size_t> DirtyRectCommandBegins; //  CulledDrawCommands ϴ ġԴϴ.  ü  ֽϴ.
+static DirtyRectStats DirtyStats = {};
+static bool bDirtyRectRedraw = DIRTY_RECT_REDRAW; // 帮 忡   ü ׸ ϴ.
+
+/*
+	 Ŷ      Ʈ Դϴ.
+	ùķ̼   尡 ϳ ,  ϳ  ֱٿ ϼ Ŷ ReadyFramePacketIndex ֽϴ.
+	Ŷ  ų  ׸  ڱ Ŷ غ Ŷ  ¹ٲٹǷ  ٸ ʽϴ.
+	   ׸  Ŷ  Ŷ ü˴ϴ.
+	   Ŷ   ʰ FramePacketCondition  ùķ̼ 尡 Ŷ ѱ  ϴ.
+*/
+static constexpr uint32_t FRAME_PACKET_NEW = 0x80000000u; // غ Ŷ  ׷ ʾ Ÿϴ.
+
+static FramePacket FramePackets[3];
+static uint32_t SimulationFramePacketIndex = 0; // ùķ̼ 常 մϴ.
+static uint32_t RenderFramePacketIndex = 1; //  常 մϴ.
+static std::atomic<uint32_t> ReadyFramePacketIndex(2);
+static std::atomic<bool> bRenderThreadRunning(false);
+static std::mutex FramePacketMutex;
+static std::condition_variable FramePacketCondition;
+
+/*
+	帮 忡 Ŷ ǳʶ ʰ  ׸ϴ. ùķ̼   尡  Ŷ   ٸϴ.
+	 带 ϱ  ٲߴϴ.
+*/
+static bool bRenderEveryFramePacket = false;
+static RenderThreadFrameStats RenderThreadStats = {}; //  常 ϴ. 带 ģ ڿ нϴ.
+
+#ifdef __linux__
+static int TextureWatchHandle = -1; // inotify νϽԴϴ.
+#else
+static HANDLE TextureWatchHandle = INVALID_HANDLE_VALUE; // ϴ  ڵԴϴ.
+static OVERLAPPED TextureWatchOverlapped = {}; //   񵿱 нϴ.  hEvent ȣ˴ϴ.
+alignas(DWORD) static uint8_t TextureWatchBuffer[4096]; // ReadDirectoryChangesW FILE_NOTIFY_INFORMATION äϴ.
+#endif
+static unordered_map<string, TextureFileState> TextureFileStates; //   ã  ؽó   Դϴ.  η ãϴ.
+static std::set<string> RetryTextureFilePaths; // ٽ   Դϴ.  ˸  ˸  ٽ Ȯմϴ.
 
 /*** Global Functions ***/
+#ifndef HEADLESS_BUILD
 static void ShowGlfwError(int error, const char* description);
+static void ScrollGlfwScrollView(GLFWwindow* window, double xOffset, double yOffset);
+#endif
 static void Initialize();
 static void Update();
+static void Render(const FramePacket& framePacket);
+static void RenderFullFrame(const FramePacket& framePacket);
+static void RenderDirtyRects(const FramePacket& framePacket);
+static void DrawCommandSprites(const DrawCommand& drawCommand);
+static bool FindDirtyRects(const FramePacket& framePacket);
+static bool CullDirtyRectInstances(const FramePacket& framePacket);
+static void AddDirtyRect(ScreenRect rect);
+static ScreenRect GetSpriteScreenBounds(const mat4& projectionViewWorld, const uvec4& textureAttribute, const uvec4& style, const ScreenRect* clipRects, bool bPointSprite);
+static bool IsScreenRectEmpty(const ScreenRect& rect);
+static bool AreScreenRectsOverlapping(const ScreenRect& a, const ScreenRect& b);
+static ScreenRect GetScreenRectUnion(const ScreenRect& a, const ScreenRect& b);
+static void PrintDirtyRectStats(FILE* stream);
+static void RunRenderThread(GLFWwindow* window);
+#ifndef HEADLESS_BUILD
+static bool IsSceneChanged();
+#endif
+static void NotifyFramePacket();
+static void WaitForFramePacket(double timeout);
+static void WaitForFramePacketTaken();
+#ifndef HEADLESS_BUILD
+static void PrintIdleFrameStats(FILE* stream);
+#endif
 static void Shutdown();
+static int RunHeadless(const RenderBackend& backend);
+static int RunSortBenchmark();
+
+static void InitializeGlesBackend(uint32_t maxInstanceCount);
+static void ShutdownGlesBackend();
+static void CreateGlesTextureArray(uint32_t format, uint32_t width, uint32_t height, uint32_t layerCount);
+static void BeginGlesFrame(bool bPreserveContents);
+static void UploadGlesInstances(const mat4* projectionViewWorlds, const uvec4* textureAttributes, const uvec4* spriteStyles, uint32_t instanceCount);
+static void UploadGlesClipRects(const ScreenRect* rects, uint32_t rectCount);
+static void UploadGlesNineSliceBorders(const NineSliceBorder* borders, uint32_t borderCount);
+static void DrawGlesSprites(const SpriteDrawState& drawState, uint32_t firstInstance, uint32_t instanceCount);
+static void BeginGlesLayer(uint32_t layer);
+static void EndGlesLayer();
+static void DrawGlesLayer(uint32_t layer);
+static void BeginGlesRegion(const ScreenRect& rect);
+static void EndGlesRegion();
+static void EndGlesFrame();
+static void PrintGlesStats(FILE* stream);
+static void UpdateDynamicResolution();
+static void PollGpuFrameTimers();
+static bool IsGpuFencePending();
+static void SetRenderScale(float renderScale);
+static void BeginGpuFrameTimer(bool bFullFrame);
+static void EndGpuFrameTimer();
+static void AddGpuFrameTime(double minGpuFrameTime, double maxGpuFrameTime, float renderScale, bool bFullFrame);
+static void PrintDynamicResolutionStats(FILE* stream);
 
 static void InitializeTextureAtlas();
-static void LoadTexture(const char* fileName, uint32_t* textureOffsetX, size_t* allAstcDataSize, std::list<AstcFile>* astcFiles);
-static void CompileShader(GLuint* shader, const GLenum type, const char* shaderFilePath);
-
-/*** Defines ***/
-#ifdef _DEBUG // gl Լ ȣ   ִ ˻մϴ.    ۵մϴ.
-	#define GL_CALL(x) \
-			(x); \
-			{ \
-				GLenum errorLog; \
-				if ((errorLog = glGetError()) != GL_NO_ERROR) \
-				{ \
-					printf("OpenGL Error: 0x%X\n", errorLog); \
-					__debugbreak(); \
-				} \
-			}
-#else
-	#define GL_CALL(x) (x);
+static bool BuildTextureAtlas(TextureAtlas* outTextureAtlas);
+static void UploadTextureAtlas(const TextureAtlas& textureAtlas);
+static bool RebuildTextureAtlas();
+static bool LoadTexture(const char* fileName, unordered_map<string, TextureAttribute>* textureAttributes, uint32_t* textureOffsetX, size_t* allAstcDataSize
+	, std::list<AstcFile>* astcFiles, std::list<Ktx2Image>* ktx2Images);
+static bool ReadAstcHeader(FILE* astcData, uint32_t* imageWidth, uint32_t* imageHeight, size_t* astcDataSize);
+static TextureAttribute MakeTextureAttribute(uint32_t imageWidth, uint32_t imageHeight, uint32_t textureOffsetX);
+static SpriteBlendMode ClassifyTextureBlendMode(const uint8_t* astcData, uint32_t imageWidth, uint32_t imageHeight);
+static uint32_t ComputeTextureAverageColor(const uint8_t* astcData, uint32_t imageWidth, uint32_t imageHeight);
+static bool LoadKtx2Image(const string& textureName, Ktx2Image* outImage, uint32_t* imageWidth, uint32_t* imageHeight);
+static bool ReadKtx2Images(const std::list<Ktx2Image>& ktx2Images, uint8_t* imageDatas);
+static bool IsKtx2TextureName(const string& textureName);
+static string GetTextureFilePath(const string& textureName);
+static void UploadTextureArrayData(size_t dataOffset, const uint8_t* data, size_t dataSize);
+static void UpdateTextureArrayWasteSize();
+
+static bool IsAstcSupported();
+static GLenum SelectTextureArrayFormat();
+static bool IsGlExtensionSupported(const char* extensionName);
+static void TranscodeTextureArrayData(const uint8_t* astcData, size_t dataSize, uint8_t* outData);
+static bool LoadTranscodedTextureArray(uint64_t sourceHash, uint8_t* outData, size_t dataSize);
+static void SaveTranscodedTextureArray(uint64_t sourceHash, const uint8_t* data, size_t dataSize);
+static uint64_t HashData(const uint8_t* data, size_t dataSize);
+static void CreateCacheDirectory(const char* directoryPath);
+
+static void InitializeTextureWatcher();
+static void UpdateTextureWatcher();
+static void ShutdownTextureWatcher();
+static bool ReadTextureFileState(const string& filePath, TextureFileState* outState);
+#ifndef __linux__
+static void RequestTextureDirectoryChanges();
 #endif
+static bool ReloadTexture(const string& fileName);
+static GLuint BeginShaderProgram(const char* vertexShaderFilePath, const char* fragmentShaderFilePath, const char* defines = "");
+static void CompileShaderProgram(ShaderProgramBuild* build);
+static void FinishShaderProgram(GLuint shaderProgram);
+static void PollShaderPrograms();
+static bool IsShaderProgramPending(GLuint shaderProgram);
+static void ApplyTextureArrayUniforms(GLuint shaderProgram);
+static void ApplyViewportSizeUniform(GLuint shaderProgram);
+static string ReadShaderSource(const char* shaderFilePath, const char* defines);
+static void CompileShader(GLuint* shader, const GLenum type, const string& shaderSource);
+static void CheckShaderCompileStatus(GLuint shader);
+static void LinkShaderProgram(GLuint shaderProgram, GLuint vertexShader, GLuint fragmentShader);
+static uint64_t HashShaderProgram(const string& vertexShaderSource, const string& fragmentShaderSource);
+static GLuint LoadProgramBinary(uint64_t programHash);
+static void SaveProgramBinary(uint64_t programHash, GLuint shaderProgram);
+static void SetInstanceAttributePointers(GLsizei firstInstance);
+static void WriteSpriteInstance(FramePacket* framePacket, GLsizei instance, int spriteIndex, const TextureAttribute& textureAttribute, bool bPointSprite);
+static void DrawSpriteInstances(GLsizei firstInstance, GLsizei instanceCount);
+static void DrawSpritePointInstances(GLsizei firstInstance, GLsizei instanceCount);
+static bool IsPointSprite(const Sprite& sprite, const Material& material, const TextureAttribute& textureAttribute);
+static uint16_t CreateMaterial(MaterialBlendMode blendMode, MaterialLayer layer, const vec4& tint);
+static void SetSpriteCacheLayer(int spriteIndex, uint32_t cacheLayer);
+static void SetSpriteStyle(int spriteIndex, float rotation, const vec2& pivot, bool bFlipX, bool bFlipY, const vec4& tint);
+static uint32_t CreateClipRect(const ScreenRect& rect);
+static void SetClipRect(uint32_t clipRect, const ScreenRect& rect);
+static void MoveScrollView(uint32_t scrollView, int32_t offsetY);
+static void SetSpriteClipRect(int spriteIndex, uint32_t clipRect);
+static uint32_t CreateNineSliceBorder(uint16_t left, uint16_t right, uint16_t bottom, uint16_t top);
+static void SetSpriteSize(int spriteIndex, uint32_t width, uint32_t height);
+static void SetSpriteNineSliceBorder(int spriteIndex, uint32_t border);
+static void MarkCacheLayerDirty(uint32_t cacheLayer);
+static void MarkSceneDirty();
+static void CreateLayerTarget(uint32_t layer);
+static uint64_t GetSpriteSortKey(uint32_t cacheLayer, MaterialLayer layer, SpriteBlendMode pass, bool bPointSprite, uint16_t materialID);
+static void ApplyMaterial(const SpriteDrawState& drawState);
+static void ResetRenderState();
+
+// â GL ؽƮ   ϴ 鿣Դϴ.
+static const RenderBackend GLES_RENDER_BACKEND =
+{
+	"OpenGLES",
+	InitializeGlesBackend,
+	ShutdownGlesBackend,
+	IsAstcSupported,
+	CreateGlesTextureArray,
+	UploadTextureArrayData,
+	BeginGlesFrame,
+	UploadGlesInstances,
+	UploadGlesClipRects,
+	UploadGlesNineSliceBorders,
+	DrawGlesSprites,
+	BeginGlesLayer,
+	EndGlesLayer,
+	DrawGlesLayer,
+	BeginGlesRegion,
+	EndGlesRegion,
+	EndGlesFrame,
+	PrintGlesStats
+};
 
-int main()
+int main(int argc, char* argv[])
 {
+#ifdef _WIN32 // ޸  ˻ MSVC  Ÿӿ ֽϴ.
 	_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF | _CRTDBG_LEAK_CHECK_DF);
 	//_CrtSetBreakAlloc(16415);
+#endif
+
+	// â GPU   鿣   մϴ. CI  Դϴ.
+	if (argc > 1 && strcmp(argv[1], "--headless") == 0)
+	{
+		return RunHeadless(GetNullRenderBackend());
+	}
+
+	// Update   Ű  Ʈ ϴ ð ϴ.
+	if (argc > 1 && strcmp(argv[1], "--sort-benchmark") == 0)
+	{
+		return RunSortBenchmark();
+	}
+
+	// GPU  CPU ׸   ̹ մϴ.  ° ڷ  θ ٲ  ֽϴ.
+	if (argc > 1 && strcmp(argv[1], "--software") == 0)
+	{
+		SetSoftwareRenderTargetSize(SCREEN_WIDTH, SCREEN_HEIGHT);
+		SoftwareFrameFilePath = argc > 2 ? argv[2] : SOFTWARE_FRAME_FILE_PATH;
+
+		if (argc <= 2)
+		{
+			CreateCacheDirectory(SOFTWARE_FRAME_DIRECTORY);
+		}
+
+		return RunHeadless(GetSoftwareRenderBackend());
+	}
+
+#ifdef HEADLESS_BUILD
+	fprintf(stderr, "This build has no window. Run with --headless, --software [path] or --sort-benchmark.\n");
 
+	return 1;
+#else
 	glfwSetErrorCallback(ShowGlfwError);
 
 	if (glfwInit() == false)
@@ -142,110 +787,118 @@ int main()
 	assert(window != nullptr && "Failed to create window");
 
 	glfwMakeContextCurrent(window);
+
+	//  ̺Ʈ glfwPollEvents ȿ ȣǹǷ ùķ̼ 忡 ũ 並 űϴ.
+	glfwSetScrollCallback(window, ScrollGlfwScrollView);
+
+	Backend = &GLES_RENDER_BACKEND;
 	
 	//  ʱȭ, ؽó ε  óմϴ.
 	Initialize();
 
-	int frameCount = 0;
-	double interval = 0.0;
-	std::chrono::system_clock::time_point startTime;
-	std::chrono::system_clock::time_point endTime;
+	PrintGpuMemoryStats(stdout);
+
+	//  GL ȣ   忡 մϴ. ؽƮ  忡  ؽƮ   Ƿ ݴϴ.
+	glfwMakeContextCurrent(nullptr);
 
+	bRenderThreadRunning = true;
+	thread renderThread(RunRenderThread, window);
+
+	InitializeFramePacer(TARGET_FRAME_RATE);
+
+	double unchangedTime = 0.0; //  ٲ  ä  ð()Դϴ.
+
+	//   ùķ̼ 尡 Ǿ  Ŷ ϴ.  尡 N°  ׸  N+1°  ϴ.
 	while (glfwWindowShouldClose(window) == false)
 	{
-		startTime = std::chrono::system_clock::now();
+		// ̺Ʈ ó GLFW   忡 ؾ ˴ϴ.
+		glfwPollEvents();
+
+		const bool bSceneChanged = IDLE_FRAME_SKIPPING == false || IsSceneChanged();
 
-		// ̴ Ʈ,   óմϴ.
+		if (bSceneChanged)
 		{
-			glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
-			glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+			//  ִ    ƴϹǷ ݺ ٽ ֱ⸦ ϴ.
+			if (bSceneIdle)
+			{
+				bSceneIdle = false;
+				ResumeFramePacer();
+			}
 
-			Update();
+			unchangedTime = 0.0;
 
-			glfwPollEvents();
-			glfwSwapBuffers(window);
+			Update();
 		}
+		else
+		{
+			++IdleStats.SkippedFrameCount;
 
-		endTime = std::chrono::system_clock::now();
+			// ѵ ٲ ʾ  ̼  ̺Ʈ ٸ ϴ. Է   ð  ϴ.
+			if (unchangedTime >= IDLE_ENTER_DELAY)
+			{
+				bSceneIdle = true;
+				glfwWaitEventsTimeout(1.0 / IDLE_FRAME_RATE);
+				++IdleStats.IdleWakeCount;
+				continue;
+			}
+		}
 
-		++frameCount;
+		//    ð ٸϴ.
+		const double frameTime = WaitForNextFrame();
 
-		const long delayTime = 16 - (long)std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime).count();
+		if (bSceneChanged == false)
+		{
+			unchangedTime += frameTime;
+		}
 
-		if (delayTime > 0)
+		if (GetFramePacerStats().FrameCount >= static_cast<uint32_t>(TARGET_FRAME_RATE * FRAME_STATS_REPORT_INTERVAL))
 		{
-			Sleep(delayTime);
+			PrintFramePacerStats(stdout);
+			ResetFramePacerStats();
+			PrintIdleFrameStats(stdout);
 		}
 	}
 
+	//  尡   Ḧ Ȯϵ ϴ.
+	bRenderThreadRunning = false;
+	NotifyFramePacket();
+	renderThread.join();
+
+	glfwMakeContextCurrent(window);
+
 	Shutdown();
 
 	glfwTerminate();
 
 	return 0;
+#endif
 }
 
+#ifndef HEADLESS_BUILD
 void ShowGlfwError(int error, const char* description)
 {
 	fputs(description, stderr);
 }
 
-void Initialize()
+void ScrollGlfwScrollView(GLFWwindow* window, double xOffset, double yOffset)
 {
-	GL_CALL(glViewport(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT));
-	GL_CALL(glEnable(GL_DEPTH_TEST));
-
-	// ̴ ʱȭմϴ.
-	{
-		GLuint vertexShader = 0;
-		CompileShader(&vertexShader, GL_VERTEX_SHADER, "Shaders/SpriteVS.glsl");
-
-		GLuint fragmentShader = 0;
-		CompileShader(&fragmentShader, GL_FRAGMENT_SHADER, "Shaders/SpriteFS.glsl");
-
-		ShaderProgram = GL_CALL(glCreateProgram());
-		GL_CALL(glAttachShader(ShaderProgram, vertexShader));
-		GL_CALL(glAttachShader(ShaderProgram, fragmentShader));
-		GL_CALL(glLinkProgram(ShaderProgram));
-
-		// ̴ ϳ Ѵٴ Ͽ α׷   մϴ.
-		GL_CALL(glUseProgram(ShaderProgram));
-
-		GL_CALL(glDeleteShader(vertexShader));
-		GL_CALL(glDeleteShader(fragmentShader));
-	}
-
-	//  ¸ ʱȭմϴ.
-	{
-		const float vertices[] =
-		{
-			1.0f, 1.0f,
-			1.0f, 0.0f,
-			0.0f, 0.0f,
-			0.0f, 1.0f
-		};
-
-		const uint32_t indices[] =
-		{
-			0, 1, 3,
-			1, 2, 3
-		};
+	//    䵵  ö󰩴ϴ. ȭ ǥ Ʒ 0Դϴ.
+	MoveScrollView(0, static_cast<int32_t>(yOffset * SCROLL_VIEW_WHEEL_STEP));
+}
+#endif
 
-		GL_CALL(glGenVertexArrays(1, &VAO));
-		GL_CALL(glBindVertexArray(VAO));
+void Initialize()
+{
+	SetGpuMemoryBudget(GPU_MEMORY_BUDGET);
 
-		GL_CALL(glGenBuffers(1, &VBO));
-		GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, VBO));
-		GL_CALL(glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW));
+	// , ؽó ȯ, CPU ȭ Բ  ۾ Դϴ. 鿣尡     Ƿ  ϴ.
+	InitializeJobPool();
 
-		//  Ͱ  ̴ ˷ݴϴ.
-		GL_CALL(glEnableVertexAttribArray(0));
-		GL_CALL(glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), nullptr));
+	// , νϽ , ̴  ׸⿡ ʿ ü ϴ.
+	Backend->Initialize(SPRITE_COUNT);
 
-		GL_CALL(glGenBuffers(1, &EBO));
-		GL_CALL(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO));
-		GL_CALL(glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW));
-	}
+	// ASTC   ؽó ̸   ü  ȯմϴ.
+	TextureArrayFormat = SelectTextureArrayFormat();
 
 	// Ʈ ʱȭմϴ.
 	{
@@ -257,6 +910,17 @@ void Initialize()
 		// ڵ带 ϰ óϱ  ASTC  ڷ ߽ϴ.
 		// ҽ  ϴ ASTC  ̸  մϴ.
 		uniform_int_distribution<int> uidImageKindRange(0, 33);
+
+		// κ丮 ȭó ũ     Ϻθ  â ϳ ϴ. ߸ Ʈ ׸⸦  ʽϴ.
+		for (uint32_t view = 0; view < SCROLL_VIEW_COUNT; ++view)
+		{
+			ScrollViewClipRects[view] = CreateClipRect({ 330 + static_cast<int32_t>(view % 2) * 320, 150 + static_cast<int32_t>(view / 2) * 220, 300, 200 });
+		}
+
+		const uint32_t worldWindowClipRect = CreateClipRect({ 100, 100, SCREEN_WIDTH - 200, SCREEN_HEIGHT - 200 });
+
+		// ũ   Ϻ UI ׵θ  ä ø гη ׸ϴ. г ϳ νϽ ϳԴϴ.
+		const uint32_t panelBorder = CreateNineSliceBorder(32, 32, 32, 32);
 		
 		for (int i = 0; i < SPRITE_COUNT; ++i)
 		{
@@ -269,262 +933,3590 @@ void Initialize()
 
 			Sprites[i] =
 			{
-				"Resources/" + to_string(uidImageKindRange(randomEngine)) + ".astc"
+				RESOURCE_DIRECTORY + to_string(uidImageKindRange(randomEngine)) + ".astc"
 				, static_cast<float>(uidHorizontalRange(randomEngine))
 				, static_cast<float>(uidVerticalRange(randomEngine))
+				, MATERIAL_DEFAULT
+				, UNCACHED_LAYER
+				, DEFAULT_SPRITE_STYLE
 			};
+
+			// Ƽ󺰷  ׷  Ȯϱ  Ϻ Ʈ ٸ Ƽ մϴ.
+			if (i % 16 == 1)
+			{
+				Sprites[i].MaterialID = MATERIAL_ADDITIVE;
+			}
+			else if (i % 16 == 2)
+			{
+				Sprites[i].MaterialID = MATERIAL_TINTED;
+			}
+			else if (i % 64 == 3)
+			{
+				Sprites[i].MaterialID = MATERIAL_UI;
+				SetSpriteClipRect(i, ScrollViewClipRects[(i / 64) % SCROLL_VIEW_COUNT]);
+
+				if (i % 128 == 3)
+				{
+					SetSpriteNineSliceBorder(i, panelBorder);
+					SetSpriteSize(i, 280, 100);
+				}
+			}
+
+			// ȸϰų ų  ٲ Ʈ  νϽ ׷  Ȯϱ  Ϻ Ʈ Ÿ մϴ.
+			if (i % 8 == 5)
+			{
+				SetSpriteStyle(i, i * 0.1f, vec2(0.5f), false, false, vec4(1.0f));
+
+				// ȸ Ʈ ׸Ʈ ̴ ߸ϴ.
+				if (i % 32 == 13)
+				{
+					SetSpriteClipRect(i, worldWindowClipRect);
+				}
+			}
+			else if (i % 8 == 6)
+			{
+				SetSpriteStyle(i, 0.0f, vec2(0.0f), true, i % 16 == 14, vec4(0.6f, 0.8f, 1.0f, 0.75f));
+			}
+			else if (i % 8 == 4)
+			{
+				// ָ   ó  ȼ  Ʈ ؽó  ʰ  ׷ϴ.
+				SetSpriteSize(i, 3, 3);
+			}
 		}
 
 		InitializeTextureAtlas();
 	}
-}
 
-void Update()
-{
-	for (int i = 0; i < SPRITE_COUNT; ++i)
+	// Ƽ ʱȭմϴ.  MATERIAL_* ȣ ƾ մϴ.
 	{
-		const Sprite& Sprite = Sprites[i];
-		const vec3 spritePosition = { Sprite.X, Sprite.Y, i };
-		const uvec3& textureAttribute = TextureAttributes[Sprite.ImagePath];
+		CreateMaterial(MATERIAL_BLEND_ALPHA, MATERIAL_LAYER_WORLD, vec4(1.0f));
+		CreateMaterial(MATERIAL_BLEND_ADDITIVE, MATERIAL_LAYER_WORLD, vec4(1.0f));
+		CreateMaterial(MATERIAL_BLEND_ALPHA, MATERIAL_LAYER_WORLD, vec4(1.0f, 0.5f, 0.5f, 1.0f));
+		CreateMaterial(MATERIAL_BLEND_ALPHA, MATERIAL_LAYER_UI, vec4(1.0f));
 
-		ProjectionViewWorldBuffer[i] = translate(PROJECTION_VIEW, spritePosition);
-		ProjectionViewWorldBuffer[i] = scale(ProjectionViewWorldBuffer[i], { uvec2(textureAttribute), 0.0f });
-
-		TextureAttributeBuffer[i] = textureAttribute;
+		CurrentRenderState = { 0, -1 };
 	}
 
-	//  ޸𸮿 ProjectionViewWorldBuffer ͸ մϴ.
+	if (CACHE_STATIC_WORLD)
 	{
-		GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, ProjectionViewWorldVBO));
+		for (int i = 0; i < SPRITE_COUNT; ++i)
+		{
+			if (Materials[Sprites[i].MaterialID].Layer == MATERIAL_LAYER_WORLD)
+			{
+				SetSpriteCacheLayer(i, CACHE_LAYER_WORLD);
+			}
+		}
+	}
+}
 
-		void* dataPtr = GL_CALL(glMapBufferOES(GL_ARRAY_BUFFER, GL_WRITE_ONLY));
-		memcpy(dataPtr, ProjectionViewWorldBuffer.get(), sizeof(mat4) * SPRITE_COUNT);
+void Update()
+{
+	/*
+		Ʈ  Ű    ϰ, Ű    νϽ   ׸ϴ.
+		Ű  Ʈ ĳ ̾(2), ̾(2), н(2), (1), Ƽ(16) 23Ʈ ̷   Ʈ մϴ.
+		ĳ ̾   Ƿ  ĳ ̾ ׸  ؼ ɴϴ.
 
-		GL_CALL(glUnmapBufferOES(GL_ARRAY_BUFFER));
-	}
+		discard ִ ̴ κ GPU early-Z   ģ ȼ  ̵ϰ ˴ϴ.
+		׷  н discard  ̴  ׸  ׽Ʈ н   ׸ϴ.
+		  н Ƽ    Ƽ ȿ տ   ׸ϴ.
+		 н ̴  ߿ϹǷ ڿ   ׸ ̿ Ʈ Ƽ   ϴ.
+		׷  н Ƽ  ʴ 32 Ʈ  ΰ    ϴ.
+		 ׸  Ʈ  н 簢  ׸ ڿ Ƽ󸶴   ׸ϴ.
 
-	//  ޸𸮿 TextureAttributeBuffer ͸ մϴ.
-	{
-		GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, TextureAttributeVBO));
+		̴ Ʈ ȣ̹Ƿ Ű  ʰ   Ű   ϴ  ̿մϴ.
+		 ƴ Ʈ 迭 տ ȣ (տ ),  Ʈ ڿ(ڿ ) äϴ.
 
-		void* dataPtr = GL_CALL(glMapBufferOES(GL_ARRAY_BUFFER, GL_WRITE_ONLY));
-		memcpy(dataPtr, TextureAttributeBuffer.get(), sizeof(vec3) * SPRITE_COUNT);
+		⼭ GL ȣ ʰ   Ŷ   忡 ѱ⸸ մϴ.
+	*/
+	FramePacket& framePacket = FramePackets[SimulationFramePacketIndex];
 
-		GL_CALL(glUnmapBufferOES(GL_ARRAY_BUFFER));
-	}
+	//  ε ߿ ؽó Ӽ ٲ  Ƿ νϽ ͸    ޴ϴ.
+	std::unique_lock<std::mutex> textureAttributesLock(TextureAttributesMutex);
 
-	GL_CALL(glDrawElementsInstanced(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0, SPRITE_COUNT));
-}
+	int frontSortItemCount = 0;
+	int backSortItemIndex = SPRITE_COUNT;
 
-void Shutdown()
-{
-	GL_CALL(glDeleteBuffers(1, &EBO));
-	GL_CALL(glDeleteBuffers(1, &VBO));
-	GL_CALL(glDeleteBuffers(1, &VAO));
-	GL_CALL(glDeleteProgram(ShaderProgram));
-}
-
-void InitializeTextureAtlas()
-{
-	// ProjectionViewWorldVBO  ̴ ˷ݴϴ.
+	for (int i = 0; i < SPRITE_COUNT; ++i)
 	{
-		GL_CALL(glGenBuffers(1, &ProjectionViewWorldVBO));
-		GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, ProjectionViewWorldVBO));
+		const Sprite& sprite = Sprites[i];
+		const Material& material = Materials[sprite.MaterialID];
+		const TextureAttribute& textureAttribute = TextureAttributes[sprite.ImagePath];
+		SpriteTextureAttributes[i] = &textureAttribute;
 
-		for (int i = 1; i <= 4; i++)
+		//   ƴ Ƽ UI, νϽ   Ʈ ؽó  ̸  ʰ ׸  Դϴ.
+		SpriteBlendMode pass = textureAttribute.BlendMode;
+
+		if (material.BlendMode != MATERIAL_BLEND_ALPHA || material.Layer == MATERIAL_LAYER_UI || (sprite.Style.z >> 24) < 255)
 		{
-			GL_CALL(glEnableVertexAttribArray(i));
-			GL_CALL(glVertexAttribPointer(i, 4, GL_FLOAT, GL_FALSE, sizeof(mat4), reinterpret_cast<void*>(sizeof(vec4) * (i - 1))));
-			GL_CALL(glVertexAttribDivisor(i, 1));
+			pass = SPRITE_BLEND_TRANSLUCENT;
+		}
+
+		// ȸϰ ߸ Ʈ ׸Ʈ  ǹǷ discard   ̴ ׸  ϴ.
+		if (pass == SPRITE_BLEND_OPAQUE && GetSpriteStyleClipRect(sprite.Style) != 0 && (sprite.Style.x & 0xFFFFu) != 0)
+		{
+			pass = SPRITE_BLEND_ALPHA_TEST;
+		}
+
+		//  ؽó Ŀ   ŭ ũ ϰ ׸Ƿ  н ׸ϴ.
+		const bool bPointSprite = IsPointSprite(sprite, material, textureAttribute);
+
+		if (bPointSprite)
+		{
+			pass = SPRITE_BLEND_OPAQUE;
 		}
 
-		GL_CALL(glBufferData(GL_ARRAY_BUFFER, sizeof(mat4) * SPRITE_COUNT, nullptr, GL_DYNAMIC_DRAW));
+		const uint64_t sortKey = GetSpriteSortKey(sprite.CacheLayer, material.Layer, pass, bPointSprite, sprite.MaterialID);
+
+		// Ʈ ȣ  ̸ Ŭ ڿ ֽϴ.
+		const int sortItemIndex = pass == SPRITE_BLEND_TRANSLUCENT ? --backSortItemIndex : frontSortItemCount++;
+
+		SpriteSortItems[sortItemIndex] = { sortKey, static_cast<uint32_t>(i) };
 	}
 
-	// TextureAttributeVBO  ̴ ˷ݴϴ.
+	RadixSort(SpriteSortItems.get(), SpriteSortScratch.get(), SPRITE_COUNT, SPRITE_SORT_KEY_BIT_COUNT);
+
+	for (int i = 0; i < SPRITE_COUNT; ++i)
 	{
-		GL_CALL(glGenBuffers(1, &TextureAttributeVBO));
-		GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, TextureAttributeVBO));
+		const uint32_t spriteIndex = SpriteSortItems[i].Value;
+		WriteSpriteInstance(&framePacket, i, spriteIndex, *SpriteTextureAttributes[spriteIndex], ((SpriteSortItems[i].Key >> 16) & 1) != 0);
+	}
 
-		GL_CALL(glEnableVertexAttribArray(5));
-		GL_CALL(glVertexAttribPointer(5, 4, GL_FLOAT, GL_FALSE, sizeof(vec3), nullptr));
-		GL_CALL(glVertexAttribDivisor(5, 1));
+	// ؽó ٲ ĳ ̾ ٽ ׷ ǹǷ ؽó 븦  մϴ.    þ⸸ մϴ.
+	for (uint32_t layer = 0; layer < CACHED_LAYER_COUNT; ++layer)
+	{
+		framePacket.CacheLayerVersions[layer] = CacheLayerVersions[layer] + TextureGeneration;
+	}
+
+	framePacket.TextureGeneration = TextureGeneration;
+
+	std::copy(ClipRects, ClipRects + ClipRectCount, framePacket.ClipRects);
+	framePacket.ClipRectCount = ClipRectCount;
 
-		GL_CALL(glBufferData(GL_ARRAY_BUFFER, sizeof(vec3) * SPRITE_COUNT, nullptr, GL_DYNAMIC_DRAW));
+	std::copy(NineSliceBorders, NineSliceBorders + NineSliceBorderCount, framePacket.NineSliceBorders);
+	framePacket.NineSliceBorderCount = NineSliceBorderCount;
+
+	UpdatedSceneGeneration = SceneGeneration;
+	UpdatedTextureGeneration = TextureGeneration;
+
+	textureAttributesLock.unlock();
+
+	// ĳ ̾, ̾, н,  , Ƽ    ׸  ϳ ϴ.
+	framePacket.DrawCommands.clear();
+
+	int runBegin = 0;
+
+	for (int i = 1; i <= SPRITE_COUNT; ++i)
+	{
+		const uint64_t runKey = SpriteSortItems[runBegin].Key;
+
+		if (i < SPRITE_COUNT && SpriteSortItems[i].Key == runKey)
+		{
+			continue;
+		}
+
+		const uint32_t spriteIndex = SpriteSortItems[runBegin].Value;
+		const uint32_t cacheLayer = static_cast<uint32_t>((runKey >> 21) & 3);
+		const SpriteBlendMode pass = static_cast<SpriteBlendMode>((runKey >> 17) & 3);
+		const bool bPointSprites = ((runKey >> 16) & 1) != 0;
+
+		framePacket.DrawCommands.push_back({ cacheLayer, Sprites[spriteIndex].MaterialID, pass, bPointSprites, runBegin, i - runBegin });
+
+		runBegin = i;
 	}
 
-	// ؽó Ʋ󽺸 ϴ.
+	//  Ŷ ׷ ϸ  尡  Ŷ   ٷ  ʽϴ.
+	if (bRenderEveryFramePacket)
 	{
-		/*
-			 ڵ   ߿մϴ.
-			켱  ASTC   θ ϱ  ū ۸ ϳ Ҵϰ ͸ ŵϴ.
-			׸ 512x512 ũ⸦  ؽó ʿ ŭ   ϴ.   ؽó Դϴ.
-			 ۸ ؽó ̿ մϴ.
-
-			     ̹ ϳ غ ּ
-			׸ ̹ ϳ   Ŀ  κ ߶ غκи ּ ̶ ڸ  κп   ˴ϴ.
-			׷  ̹ غκи  ̹ غǴµ     ASTC Ϸ  ּ
-			     Ͱ ɷ   Ƹ غκи ִ ASTC    ̹ ASTC  뿡  ̴ϴ.
-			   512x512  ū ̹  ̹  ִ Դϴ.
-		*/
+		WaitForFramePacketTaken();
+	}
 
-		size_t allAstcDataSize = 0;
-		uint32_t currentTextureArrayOffsetX = 0;
-		std::list<AstcFile> astcFiles;
+	// ϼ Ŷ غ Ŷ ¹ٲߴϴ.  Ŷ  尡  ʴ ŶԴϴ.
+	SimulationFramePacketIndex = ReadyFramePacketIndex.exchange(SimulationFramePacketIndex | FRAME_PACKET_NEW) & ~FRAME_PACKET_NEW;
 
-		for (int i = 0; i < SPRITE_COUNT; ++i)
+	NotifyFramePacket();
+}
+
+void Render(const FramePacket& framePacket)
+{
+	// ٲ  ã ߰ų ʹ  ȭ ü ׸ϴ.
+	const bool bPartialRedraw = bDirtyRectRedraw && FindDirtyRects(framePacket) && CullDirtyRectInstances(framePacket);
+
+	Backend->BeginFrame(bPartialRedraw);
+
+	// Ŭ 簢 ׵θ    Ƿ ٽ ׸    øϴ.
+	Backend->UploadClipRects(framePacket.ClipRects, framePacket.ClipRectCount);
+	Backend->UploadNineSliceBorders(framePacket.NineSliceBorders, framePacket.NineSliceBorderCount);
+
+	if (bPartialRedraw)
+	{
+		RenderDirtyRects(framePacket);
+	}
+	else
+	{
+		RenderFullFrame(framePacket);
+	}
+
+	Backend->EndFrame();
+
+	++DirtyStats.FrameCount;
+
+	if (bPartialRedraw)
+	{
+		++DirtyStats.PartialFrameCount;
+
+		for (const ScreenRect& rect : DirtyRects)
 		{
-			LoadTexture(Sprites[i].ImagePath.c_str(), &currentTextureArrayOffsetX, &allAstcDataSize, &astcFiles);
+			DirtyStats.RedrawnPixelCount += static_cast<uint64_t>(rect.Width) * rect.Height;
 		}
+	}
+	else
+	{
+		DirtyStats.RedrawnPixelCount += static_cast<uint64_t>(SCREEN_WIDTH) * SCREEN_HEIGHT;
+	}
+}
+
+void RenderFullFrame(const FramePacket& framePacket)
+{
+	Backend->UploadInstances(framePacket.ProjectionViewWorlds.get(), framePacket.TextureAttributes.get(), framePacket.SpriteStyles.get(), SPRITE_COUNT);
+
+	const std::vector<DrawCommand>& drawCommands = framePacket.DrawCommands;
+	size_t command = 0;
+
+	// ĳ ̾  ٲ ӿ ٽ ׸,  ӿ ׷ ̾ ռ մϴ.
+	for (uint32_t layer = 0; layer < CACHED_LAYER_COUNT; ++layer)
+	{
+		const size_t layerBegin = command;
 
-		constexpr GLsizei textureArrayWidth = 512;
-		constexpr GLsizei textureArrayHeight = 512;
-		constexpr GLsizei textureArrayArea = textureArrayWidth * textureArrayHeight;
-		const GLsizei textureArrayDepth = static_cast<GLsizei>(ceilf(allAstcDataSize / static_cast<float>(textureArrayArea)));
+		while (command < drawCommands.size() && drawCommands[command].CacheLayer == layer)
+		{
+			++command;
+		}
 
-		//  ASTC ͸ ϱ  ̹ Դϴ.
-		size_t dataIndex = 0;
-		auto imageDatas = std::make_unique<uint8_t[]>(textureArrayArea * textureArrayDepth);
+		//  ִ ̾ ׸ Ƿ ٽ ä   ٲ ֱ⸸ ϸ ˴ϴ.
+		if (command == layerBegin)
+		{
+			RenderedCacheLayerVersions[layer] = framePacket.CacheLayerVersions[layer];
+			continue;
+		}
 
-		// ASTC  о ̹ ۿ մϴ.
-		for (const auto& astcFile : astcFiles)
+		if (RenderedCacheLayerVersions[layer] != framePacket.CacheLayerVersions[layer])
 		{
-			fseek(astcFile.data, sizeof(AstcHeader), SEEK_SET);
-			fread(imageDatas.get() + dataIndex, astcFile.size, 1, astcFile.data);
-			dataIndex += astcFile.size;
+			Backend->BeginLayer(layer);
+
+			for (size_t i = layerBegin; i < command; ++i)
+			{
+				DrawCommandSprites(drawCommands[i]);
+			}
+
+			Backend->EndLayer();
 
-			fclose(astcFile.data);
+			RenderedCacheLayerVersions[layer] = framePacket.CacheLayerVersions[layer];
 		}
 
-		GL_CALL(glGenTextures(1, &TextureArray));
-		GL_CALL(glBindTexture(GL_TEXTURE_2D_ARRAY, TextureArray));
+		Backend->DrawLayer(layer);
+	}
 
-		GL_CALL(glTexStorage3D(GL_TEXTURE_2D_ARRAY, 1, GL_COMPRESSED_RGBA_ASTC_4x4_KHR
-			, textureArrayWidth, textureArrayHeight, textureArrayDepth));
+	for (; command < drawCommands.size(); ++command)
+	{
+		DrawCommandSprites(drawCommands[command]);
+	}
+}
 
-		GL_CALL(glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_REPEAT));
-		GL_CALL(glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_REPEAT));
-		GL_CALL(glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_NEAREST));
-		GL_CALL(glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_NEAREST));
+void RenderDirtyRects(const FramePacket& framePacket)
+{
+	if (CulledInstanceCount > 0)
+	{
+		Backend->UploadInstances(CulledProjectionViewWorlds.get(), CulledTextureAttributes.get(), CulledSpriteStyles.get(), CulledInstanceCount);
+	}
 
-		const GLint uTexSamplerArrayID = GL_CALL(glGetUniformLocation(ShaderProgram, "uTexArraySampler"));
-		GL_CALL(glUniform1i(uTexSamplerArrayID, 0));
+	// ĳ ̾ ٲ ʾ   Ƿ  ռ ϰ,    ģ ĳ  Ʈ ׸ϴ.
+	bool bLayersUsed[CACHED_LAYER_COUNT] = {};
 
-		// ؽó ̿ ̹ ۸ մϴ.
-		for (int i = 0; i < textureArrayDepth; ++i)
+	for (const DrawCommand& drawCommand : framePacket.DrawCommands)
+	{
+		if (drawCommand.CacheLayer < CACHED_LAYER_COUNT)
 		{
-			GL_CALL(glCompressedTexSubImage3D(
-				GL_TEXTURE_2D_ARRAY
-				, 0
-				, 0
-				, 0
-				, i
-				, textureArrayWidth
-				, textureArrayHeight
-				, 1
-				, GL_COMPRESSED_RGBA_ASTC_4x4_KHR
-				, textureArrayArea
-				, reinterpret_cast<void*>(imageDatas.get() + i * textureArrayArea)
-			));
+			bLayersUsed[drawCommand.CacheLayer] = true;
+		}
+	}
+
+	for (size_t i = 0; i < DirtyRects.size(); ++i)
+	{
+		Backend->BeginRegion(DirtyRects[i]);
+
+		for (uint32_t layer = 0; layer < CACHED_LAYER_COUNT; ++layer)
+		{
+			if (bLayersUsed[layer])
+			{
+				Backend->DrawLayer(layer);
+			}
+		}
+
+		for (size_t command = DirtyRectCommandBegins[i]; command < DirtyRectCommandBegins[i + 1]; ++command)
+		{
+			DrawCommandSprites(CulledDrawCommands[command]);
 		}
 
-		// ̴   ۸ Ҵմϴ.
-		ProjectionViewWorldBuffer = std::make_unique<mat4[]>(SPRITE_COUNT);
-		TextureAttributeBuffer = std::make_unique<vec3[]>(SPRITE_COUNT);
+		Backend->EndRegion();
 	}
 }
 
-void LoadTexture(const char* fileName, uint32_t* textureOffsetX, size_t* allAstcDataSize, std::list<AstcFile>* astcFiles)
+void DrawCommandSprites(const DrawCommand& drawCommand)
 {
-	const auto& foundTextureAttribute = TextureAttributes.find(fileName);
+	const Material& material = Materials[drawCommand.MaterialID];
+	const SpriteDrawState drawState = { drawCommand.MaterialID, drawCommand.Pass, material.BlendMode, material.Layer != MATERIAL_LAYER_UI, material.Tint, drawCommand.bPointSprites };
 
-	// ̹ ϵ ؽó ϰ  ִ  ϴ  óϿ ޸  Դϴ.
-	if (foundTextureAttribute != TextureAttributes.end())
+	Backend->DrawSprites(drawState, static_cast<uint32_t>(drawCommand.FirstInstance), static_cast<uint32_t>(drawCommand.InstanceCount));
+}
+
+bool FindDirtyRects(const FramePacket& framePacket)
+{
+	DirtyRects.clear();
+
+	// ؽó ĳ ̾ ٲ  ȼ ٲ   Ƿ ü ׸ϴ. Ʈ  ׷ صӴϴ.
+	bool bFullRedraw = bSpriteFootprintsValid == false || RenderedTextureGeneration != framePacket.TextureGeneration;
+
+	for (uint32_t layer = 0; layer < CACHED_LAYER_COUNT; ++layer)
 	{
-		return;
+		bFullRedraw = bFullRedraw || RenderedCacheLayerVersions[layer] != framePacket.CacheLayerVersions[layer];
 	}
 
-	FILE* astcData = fopen(fileName, "rb");
-	assert(astcData != nullptr && "Could not open a astc file");
+	bSpriteFootprintsValid = true;
+	RenderedTextureGeneration = framePacket.TextureGeneration;
 
-	uint32_t imageWidth = 0;
-	uint32_t imageHeight = 0;
-	size_t astcDataSize = 0;
+	// ̹ ӿ ׸  Ʈ ã     ǥصΰ ׸ Ʈ ٽ ǥմϴ.
+	bool* const bPreviouslyDrawn = bSpritesPreviouslyDrawn.get();
 
-	// ̹   ũ  ũ⸦ ɴϴ.
+	for (int i = 0; i < SPRITE_COUNT; ++i)
 	{
-		/*
-			ASTC   ڼ ˰  Ʒ ũ ϼ
-			astc : https://arm-software.github.io/opengl-es-sdk-for-android/astc_textures.html
-			⼭ ߿    ũ⸦ 4x4 ߴٴ Դϴ.
-			 ٸ  ũ⸦ ϽŴٸ main.cpp ̴ ڵ带 ϸ ˴ϴ.
-		*/
+		bPreviouslyDrawn[i] = SpriteFootprints[i].bDrawn;
+		SpriteFootprints[i].bDrawn = false;
+	}
+
+	for (const DrawCommand& drawCommand : framePacket.DrawCommands)
+	{
+		for (GLsizei instance = drawCommand.FirstInstance; instance < drawCommand.FirstInstance + drawCommand.InstanceCount; ++instance)
+		{
+			const uint32_t spriteIndex = framePacket.SpriteIndices[instance];
+			SpriteFootprint& footprint = SpriteFootprints[spriteIndex];
+
+			const SpriteFootprint newFootprint =
+			{
+				GetSpriteScreenBounds(framePacket.ProjectionViewWorlds[instance], framePacket.TextureAttributes[instance], framePacket.SpriteStyles[instance], framePacket.ClipRects, drawCommand.bPointSprites)
+				, framePacket.TextureAttributes[instance]
+				, framePacket.SpriteStyles[instance]
+				, drawCommand.CacheLayer
+				, drawCommand.MaterialID
+				, drawCommand.Pass
+				, drawCommand.bPointSprites
+				, true
+			};
 
-		AstcHeader astcHeader;
-		fread(&astcHeader, sizeof(AstcHeader), 1, astcData);
+			const bool bChanged = bPreviouslyDrawn[spriteIndex] == false
+				|| memcmp(&footprint.Bounds, &newFootprint.Bounds, sizeof(ScreenRect)) != 0
+				|| footprint.TextureAttribute != newFootprint.TextureAttribute
+				|| footprint.Style != newFootprint.Style
+				|| footprint.CacheLayer != newFootprint.CacheLayer
+				|| footprint.MaterialID != newFootprint.MaterialID
+				|| footprint.Pass != newFootprint.Pass
+				|| footprint.bPointSprite != newFootprint.bPointSprite;
 
-		imageWidth = astcHeader.xsize[0] + (astcHeader.xsize[1] << 8) + (astcHeader.xsize[2] << 16);
-		imageHeight = astcHeader.ysize[0] + (astcHeader.ysize[1] << 8) + (astcHeader.ysize[2] << 16);
+			if (bChanged && bFullRedraw == false)
+			{
+				if (bPreviouslyDrawn[spriteIndex])
+				{
+					AddDirtyRect(footprint.Bounds);
+				}
 
-		const int xBlocks = (imageWidth + astcHeader.blockdim_x - 1) / astcHeader.blockdim_x;
-		const int yBlocks = (imageHeight + astcHeader.blockdim_y - 1) / astcHeader.blockdim_y;
+				AddDirtyRect(newFootprint.Bounds);
+			}
 
-		astcDataSize = xBlocks * yBlocks << 4;
+			footprint = newFootprint;
+		}
 	}
 
-	// ̴  ؽó Ӽ մϴ.
-	TextureAttributes.insert(std::make_pair(fileName, uvec3{ imageWidth, imageHeight, *textureOffsetX }));
+	//  Ʈ    մϴ.
+	for (int i = 0; i < SPRITE_COUNT; ++i)
+	{
+		if (bPreviouslyDrawn[i] && SpriteFootprints[i].bDrawn == false && bFullRedraw == false)
+		{
+			AddDirtyRect(SpriteFootprints[i].Bounds);
+		}
+	}
 
-	// θ 4ȼ Ͽ      ؽó ؽó    ϴ.
-	imageWidth = static_cast<int>(ceilf(imageWidth / 4.0f)) * 4;
-	imageHeight = static_cast<int>(ceilf(imageHeight / 4.0f));
+	if (bFullRedraw)
+	{
+		return false;
+	}
 
-	*textureOffsetX += imageWidth * imageHeight;
-	*allAstcDataSize += astcDataSize;
-	astcFiles->push_back({ astcDataSize, astcData });
+	uint64_t dirtyArea = 0;
+
+	for (const ScreenRect& rect : DirtyRects)
+	{
+		dirtyArea += static_cast<uint64_t>(rect.Width) * rect.Height;
+	}
+
+	return dirtyArea <= DIRTY_RECT_MAX_AREA_RATIO * SCREEN_WIDTH * SCREEN_HEIGHT;
 }
 
-void CompileShader(GLuint* shader, const GLenum type, const char* shaderFilePath)
+bool CullDirtyRectInstances(const FramePacket& framePacket)
 {
-	assert(shader != nullptr && "the shader must not be null");
+	CulledInstanceCount = 0;
+	CulledDrawCommands.clear();
+	DirtyRectCommandBegins.clear();
 
-	FILE* shaderFile = fopen(shaderFilePath, "r");
-	assert(shaderFile != nullptr && "Failed to load shader");
+	/*
+		   ġ ĳ  νϽ   ״ Ƽ ׸  ٽ ϴ.
+		  ģ νϽ    Ƿ νϽ ۸  ü ׸ϴ.
+	*/
+	for (const ScreenRect& rect : DirtyRects)
+	{
+		DirtyRectCommandBegins.push_back(CulledDrawCommands.size());
 
-	// ̴  ũ⸦ ɴϴ.
-	fseek(shaderFile, 0, SEEK_END);
-	const uint32_t shaderFileSize = static_cast<uint32_t>(ftell(shaderFile));
-	rewind(shaderFile);
+		for (const DrawCommand& drawCommand : framePacket.DrawCommands)
+		{
+			if (drawCommand.CacheLayer != UNCACHED_LAYER)
+			{
+				continue;
+			}
 
-	auto shaderSource = std::make_unique<char[]>(shaderFileSize);
-	fread(shaderSource.get(), shaderFileSize, 1, shaderFile);
+			const uint32_t firstInstance = CulledInstanceCount;
 
-	// ũ ͷ ѱ  Ұϱ     ݴϴ.
-	const char* data = shaderSource.get();
+			for (GLsizei instance = drawCommand.FirstInstance; instance < drawCommand.FirstInstance + drawCommand.InstanceCount; ++instance)
+			{
+				if (AreScreenRectsOverlapping(SpriteFootprints[framePacket.SpriteIndices[instance]].Bounds, rect) == false)
+				{
+					continue;
+				}
 
-	fclose(shaderFile);
+				if (CulledInstanceCount == SPRITE_COUNT)
+				{
+					return false;
+				}
 
-	*shader = GL_CALL(glCreateShader(type));
-	GL_CALL(glShaderSource(*shader, 1, &data, nullptr));
-	GL_CALL(glCompileShader(*shader));
+				CulledProjectionViewWorlds[CulledInstanceCount] = framePacket.ProjectionViewWorlds[instance];
+				CulledTextureAttributes[CulledInstanceCount] = framePacket.TextureAttributes[instance];
+				CulledSpriteStyles[CulledInstanceCount] = framePacket.SpriteStyles[instance];
+				++CulledInstanceCount;
+			}
 
-#ifdef _DEBUG //    ̴  ˻մϴ.
-	GLint bSuccess = 0;
-	GL_CALL(glGetShaderiv(*shader, GL_COMPILE_STATUS, &bSuccess));
+			if (CulledInstanceCount > firstInstance)
+			{
+				CulledDrawCommands.push_back({ drawCommand.CacheLayer, drawCommand.MaterialID, drawCommand.Pass, drawCommand.bPointSprites
+					, static_cast<GLsizei>(firstInstance), static_cast<GLsizei>(CulledInstanceCount - firstInstance) });
+			}
+		}
+	}
 
-	if (bSuccess == 0)
+	DirtyRectCommandBegins.push_back(CulledDrawCommands.size());
+
+	return true;
+}
+
+void AddDirtyRect(ScreenRect rect)
+{
+	if (IsScreenRectEmpty(rect))
 	{
-		GLint logLength = 0;
-		GL_CALL(glGetShaderiv(*shader, GL_INFO_LOG_LENGTH, &logLength));
+		return;
+	}
 
-		if (logLength > 0)
+	// ġ  ϳ Ĩϴ. ģ  ٸ   ĥ  Ƿ  ġ   ݺմϴ.
+	for (size_t i = 0; i < DirtyRects.size();)
+	{
+		if (AreScreenRectsOverlapping(DirtyRects[i], rect))
 		{
-			auto log = std::make_unique<char[]>(logLength);
-			GL_CALL(glGetShaderInfoLog(*shader, logLength, nullptr, log.get()));
+			rect = GetScreenRectUnion(DirtyRects[i], rect);
+			DirtyRects[i] = DirtyRects.back();
+			DirtyRects.pop_back();
+			i = 0;
+		}
+		else
+		{
+			++i;
+		}
+	}
 
-			fprintf(stderr, "%s", log.get());
-			__debugbreak();
+	if (DirtyRects.size() < MAX_DIRTY_RECT_COUNT)
+	{
+		DirtyRects.push_back(rect);
+		return;
+	}
+
+	//     ؼ   þ ̰    Ĩϴ.
+	DirtyRects.push_back(rect);
+
+	size_t bestFirst = 0;
+	size_t bestSecond = 1;
+	int64_t bestGrowth = INT64_MAX;
+
+	for (size_t i = 0; i < DirtyRects.size(); ++i)
+	{
+		for (size_t j = i + 1; j < DirtyRects.size(); ++j)
+		{
+			const ScreenRect merged = GetScreenRectUnion(DirtyRects[i], DirtyRects[j]);
+			const int64_t growth = static_cast<int64_t>(merged.Width) * merged.Height
+				- static_cast<int64_t>(DirtyRects[i].Width) * DirtyRects[i].Height
+				- static_cast<int64_t>(DirtyRects[j].Width) * DirtyRects[j].Height;
+
+			if (growth < bestGrowth)
+			{
+				bestFirst = i;
+				bestSecond = j;
+				bestGrowth = growth;
+			}
+		}
+	}
+
+	const ScreenRect merged = GetScreenRectUnion(DirtyRects[bestFirst], DirtyRects[bestSecond]);
+
+	DirtyRects.erase(DirtyRects.begin() + bestSecond);
+	DirtyRects.erase(DirtyRects.begin() + bestFirst);
+
+	AddDirtyRect(merged);
+}
+
+ScreenRect GetSpriteScreenBounds(const mat4& projectionViewWorld, const uvec4& textureAttribute, const uvec4& style, const ScreenRect* clipRects, bool bPointSprite)
+{
+	if (textureAttribute.x == 0 || textureAttribute.y == 0)
+	{
+		return {};
+	}
+
+	//  簢   簢Դϴ. 1ȼ ۾ Ƿ 簢 ȼ ߽  ʾƵ ׷, ߸ ʽϴ.
+	if (bPointSprite)
+	{
+		const vec4 center = GetSpritePointCenter(projectionViewWorld, style, textureAttribute);
+		const float halfSize = GetSpritePointSize(projectionViewWorld, style, vec2(SCREEN_WIDTH, SCREEN_HEIGHT)) * 0.5f;
+		const float x = (center.x + 1.0f) * 0.5f * SCREEN_WIDTH;
+		const float y = (center.y + 1.0f) * 0.5f * SCREEN_HEIGHT;
+
+		const int32_t left = std::max(static_cast<int32_t>(std::floor(x - halfSize)), 0);
+		const int32_t bottom = std::max(static_cast<int32_t>(std::floor(y - halfSize)), 0);
+		const int32_t right = std::min(static_cast<int32_t>(std::ceil(x + halfSize)), SCREEN_WIDTH);
+		const int32_t top = std::min(static_cast<int32_t>(std::ceil(y + halfSize)), SCREEN_HEIGHT);
+
+		if (left >= right || bottom >= top)
+		{
+			return {};
 		}
+
+		return { left, bottom, right - left, top - bottom };
+	}
+
+	// 0~1 簢   ̴  ǹ ȸ ؼ ȭ ǥ ٲߴϴ.  ̹Ƿ w  ʽϴ.
+	const mat4 transform = projectionViewWorld * GetSpriteStyleTransform(style, textureAttribute);
+	float minX = FLT_MAX;
+	float minY = FLT_MAX;
+	float maxX = -FLT_MAX;
+	float maxY = -FLT_MAX;
+
+	for (const vec2 corner : { vec2(0.0f, 0.0f), vec2(1.0f, 0.0f), vec2(0.0f, 1.0f), vec2(1.0f, 1.0f) })
+	{
+		const vec4 position = transform * vec4(corner, 0.0f, 1.0f);
+		const float x = (position.x + 1.0f) * 0.5f * SCREEN_WIDTH;
+		const float y = (position.y + 1.0f) * 0.5f * SCREEN_HEIGHT;
+
+		minX = std::min(minX, x);
+		minY = std::min(minY, y);
+		maxX = std::max(maxX, x);
+		maxY = std::max(maxY, y);
+	}
+
+	// ȼ ߽ 簢 ȿ ִ ȼ  ϵ ٱ ߰ ȭ ڸϴ.
+	int32_t left = std::max(static_cast<int32_t>(std::floor(minX)), 0);
+	int32_t bottom = std::max(static_cast<int32_t>(std::floor(minY)), 0);
+	int32_t right = std::min(static_cast<int32_t>(std::ceil(maxX)), SCREEN_WIDTH);
+	int32_t top = std::min(static_cast<int32_t>(std::ceil(maxY)), SCREEN_HEIGHT);
+
+	// Ŭ 簢  ׷ Ƿ ũ 䰡  ̴ κи ٽ ׸ϴ.
+	const uint32_t clipRect = GetSpriteStyleClipRect(style);
+
+	if (clipRect != 0)
+	{
+		const ScreenRect& rect = clipRects[clipRect];
+
+		left = std::max(left, rect.X);
+		bottom = std::max(bottom, rect.Y);
+		right = std::min(right, rect.X + rect.Width);
+		top = std::min(top, rect.Y + rect.Height);
+	}
+
+	if (left >= right || bottom >= top)
+	{
+		return {};
+	}
+
+	return { left, bottom, right - left, top - bottom };
+}
+
+bool IsScreenRectEmpty(const ScreenRect& rect)
+{
+	return rect.Width <= 0 || rect.Height <= 0;
+}
+
+bool AreScreenRectsOverlapping(const ScreenRect& a, const ScreenRect& b)
+{
+	return a.X < b.X + b.Width && b.X < a.X + a.Width && a.Y < b.Y + b.Height && b.Y < a.Y + a.Height;
+}
+
+ScreenRect GetScreenRectUnion(const ScreenRect& a, const ScreenRect& b)
+{
+	const int32_t left = std::min(a.X, b.X);
+	const int32_t bottom = std::min(a.Y, b.Y);
+	const int32_t right = std::max(a.X + a.Width, b.X + b.Width);
+	const int32_t top = std::max(a.Y + a.Height, b.Y + b.Height);
+
+	return { left, bottom, right - left, top - bottom };
+}
+
+void PrintDirtyRectStats(FILE* stream)
+{
+	assert(stream != nullptr);
+
+	if (bDirtyRectRedraw == false || DirtyStats.FrameCount == 0)
+	{
+		return;
+	}
+
+	fprintf(stream, "Dirty rects: %u of %u frames redrawn partially, %.1f%% of pixels redrawn\n"
+		, DirtyStats.PartialFrameCount
+		, DirtyStats.FrameCount
+		, 100.0 * DirtyStats.RedrawnPixelCount / (static_cast<double>(DirtyStats.FrameCount) * SCREEN_WIDTH * SCREEN_HEIGHT));
+
+	DirtyStats = {};
+}
+
+void RunRenderThread(GLFWwindow* window)
+{
+#ifndef HEADLESS_BUILD
+	// 帮 忡 â ϴ.
+	if (window != nullptr)
+	{
+		glfwMakeContextCurrent(window);
+
+		//    ؽƮ ǹǷ  忡 մϴ.  ȭ Ѹ Ƽ  ֻ  ǥõ˴ϴ.
+		glfwSwapInterval(VSYNC ? 1 : 0);
 	}
 #endif
+
+	if (TEXTURE_HOT_RELOAD)
+	{
+		InitializeTextureWatcher();
+	}
+
+	while (bRenderThreadRunning)
+	{
+		if (TEXTURE_HOT_RELOAD)
+		{
+			UpdateTextureWatcher();
+		}
+
+		//  Ŷ    ٽ ׸ų  ʰ ٸϴ. ȭ鿡   ̹ ϴ.
+		if ((ReadyFramePacketIndex.load() & FRAME_PACKET_NEW) == 0)
+		{
+			// 潺 GPU ð  ̸ ȣ ð GPU_FENCE_POLL_INTERVAL    ֵ ٸ ȿ Ȯմϴ.
+			const bool bPollGpuFences = window != nullptr && DYNAMIC_RESOLUTION && IsGpuFencePending();
+
+			WaitForFramePacket(bPollGpuFences ? GPU_FENCE_POLL_INTERVAL : 1.0 / IDLE_FRAME_RATE);
+
+			if (bPollGpuFences)
+			{
+				PollGpuFrameTimers();
+			}
+
+			continue;
+		}
+
+		// ִ Ŷ  Ŷ ǥð    Ŷ  ٽ ׸ ǹǷ ϴ.
+		RenderFramePacketIndex = ReadyFramePacketIndex.exchange(RenderFramePacketIndex) & ~FRAME_PACKET_NEW;
+
+		// Ŷ  ٸ ùķ̼ 尡  Ŷ ѱ  ֽϴ.
+		if (bRenderEveryFramePacket)
+		{
+			NotifyFramePacket();
+		}
+
+		//  ٲ  ȭ ̾   Ƿ ٲ  ã  մϴ.
+		if (window != nullptr && DYNAMIC_RESOLUTION)
+		{
+			UpdateDynamicResolution();
+		}
+
+		const std::chrono::steady_clock::time_point renderStartTime = std::chrono::steady_clock::now();
+
+		Render(FramePackets[RenderFramePacketIndex]);
+
+		RenderThreadStats.RenderTime += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - renderStartTime).count();
+		++RenderThreadStats.RenderedFrameCount;
+
+		if (window == nullptr)
+		{
+			continue;
+		}
+
+#ifndef HEADLESS_BUILD
+		glfwSwapBuffers(window);
+#endif
+
+		if (RenderThreadStats.RenderedFrameCount % static_cast<uint32_t>(TARGET_FRAME_RATE * FRAME_STATS_REPORT_INTERVAL) == 0)
+		{
+			Backend->PrintStats(stdout);
+			PrintDirtyRectStats(stdout);
+		}
+	}
+
+	if (TEXTURE_HOT_RELOAD)
+	{
+		ShutdownTextureWatcher();
+	}
+
+#ifndef HEADLESS_BUILD
+	if (window != nullptr)
+	{
+		glfwMakeContextCurrent(nullptr);
+	}
+#endif
+}
+
+#ifndef HEADLESS_BUILD
+bool IsSceneChanged()
+{
+	if (SceneGeneration != UpdatedSceneGeneration)
+	{
+		return true;
+	}
+
+	// ؽó     ε尡 øǷ װ нϴ.
+	std::lock_guard<std::mutex> textureAttributesLock(TextureAttributesMutex);
+
+	return TextureGeneration != UpdatedTextureGeneration;
+}
+#endif
+
+void NotifyFramePacket()
+{
+	//  尡  Ȯ    ˷ ġ ʵ װ ˸ϴ. Ŷ ȯ ü  ʽϴ.
+	std::lock_guard<std::mutex> framePacketLock(FramePacketMutex);
+	FramePacketCondition.notify_all();
+}
+
+void WaitForFramePacket(double timeout)
+{
+	// Ŷ  ʴ ȿ  ε带 Ȯ  ֵ timeoutʰ  ϴ.
+	std::unique_lock<std::mutex> framePacketLock(FramePacketMutex);
+	FramePacketCondition.wait_for(framePacketLock, std::chrono::duration<double>(timeout)
+		, [] { return (ReadyFramePacketIndex.load() & FRAME_PACKET_NEW) != 0 || bRenderThreadRunning.load() == false; });
+}
+
+void WaitForFramePacketTaken()
+{
+	//   Ŷ   װ ˸Ƿ Ȯΰ  ̿ ˸ ġ ʽϴ.
+	std::unique_lock<std::mutex> framePacketLock(FramePacketMutex);
+	FramePacketCondition.wait(framePacketLock, [] { return (ReadyFramePacketIndex.load() & FRAME_PACKET_NEW) == 0; });
+}
+
+#ifndef HEADLESS_BUILD
+void PrintIdleFrameStats(FILE* stream)
+{
+	assert(stream != nullptr);
+
+	if (IDLE_FRAME_SKIPPING == false)
+	{
+		return;
+	}
+
+	fprintf(stream, "Idle: %u frames skipped, %u idle wakeups\n", IdleStats.SkippedFrameCount, IdleStats.IdleWakeCount);
+
+	IdleStats = {};
+}
+#endif
+
+void Shutdown()
+{
+	PrintGpuMemoryStats(stdout);
+
+	Backend->Shutdown();
+	ShutdownJobPool();
+}
+
+int RunHeadless(const RenderBackend& backend)
+{
+	Backend = &backend;
+
+	Initialize();
+
+	PrintGpuMemoryStats(stdout);
+
+	/*
+		 ð   ׸ ð ǵ Ŷ ǳʶ ʰ, ٲ  ׸ ε ϴ.
+		   ־ ٲ  ׸ κ  ƹ͵ ׸ ʱ Դϴ.
+		Update ٷ ȣϹǷ    ǳʶٴ ε ġ ʽϴ.
+	*/
+	bRenderEveryFramePacket = true;
+	bDirtyRectRedraw = false;
+	RenderThreadStats = {};
+
+	bRenderThreadRunning = true;
+	thread renderThread(RunRenderThread, nullptr);
+
+	//  ̼   尡  ŭ   Ŷ ϴ.
+	const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+	for (int i = 0; i < HEADLESS_FRAME_COUNT; ++i)
+	{
+		// Ŭ 簢 ٲٴ ε ġ ù ° ũ 並 Դϴ.  ֱⰡ  ڸ ƿɴϴ.
+		MoveScrollView(0, (i % HEADLESS_SCROLL_PERIOD) < HEADLESS_SCROLL_PERIOD / 2 ? -1 : 1);
+
+		Update();
+	}
+
+	//  Ŷ     Ŷ  ׸ ڿ Ḧ Ȯմϴ. ϴ ̹   ˴ϴ.
+	WaitForFramePacketTaken();
+
+	bRenderThreadRunning = false;
+	NotifyFramePacket();
+	renderThread.join();
+
+	const double elapsedTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+
+	assert(RenderThreadStats.RenderedFrameCount == static_cast<uint32_t>(HEADLESS_FRAME_COUNT));
+
+	printf("Headless: %d frames simulated, %u rendered in %.1f ms (%.3f ms/frame, %.3f ms/frame in Render)\n"
+		, HEADLESS_FRAME_COUNT
+		, RenderThreadStats.RenderedFrameCount
+		, elapsedTime
+		, elapsedTime / HEADLESS_FRAME_COUNT
+		, RenderThreadStats.RenderedFrameCount > 0 ? RenderThreadStats.RenderTime / RenderThreadStats.RenderedFrameCount : 0.0);
+	Backend->PrintStats(stdout);
+	PrintDirtyRectStats(stdout);
+
+	bool bSucceeded = true;
+
+	if (Backend == &GetNullRenderBackend())
+	{
+		bSucceeded = GetNullRenderBackendStats().ValidationErrorCount == 0;
+	}
+	else if (Backend == &GetSoftwareRenderBackend())
+	{
+		bSucceeded = SaveSoftwareRenderTarget(SoftwareFrameFilePath);
+	}
+
+	Shutdown();
+
+	return bSucceeded ? 0 : 1;
+}
+
+int RunSortBenchmark()
+{
+	/*
+		Update   Ű ġ SORT_BENCHMARK_ITEM_COUNT Ʈ ϴ ð ϴ.
+		´   Ƽ  ó   ϴ. Ź  Է ǵ  ð  ʽϴ.
+	*/
+	InitializeJobPool();
+
+	auto sourceItems = std::make_unique<RadixSortItem[]>(SORT_BENCHMARK_ITEM_COUNT);
+	auto items = std::make_unique<RadixSortItem[]>(SORT_BENCHMARK_ITEM_COUNT);
+	auto scratch = std::make_unique<RadixSortItem[]>(SORT_BENCHMARK_ITEM_COUNT);
+
+	std::mt19937 randomEngine(0);
+	int frontItemCount = 0;
+	int backItemIndex = SORT_BENCHMARK_ITEM_COUNT;
+
+	for (int i = 0; i < SORT_BENCHMARK_ITEM_COUNT; ++i)
+	{
+		const uint32_t cacheLayer = randomEngine() % (UNCACHED_LAYER + 1);
+		const MaterialLayer layer = static_cast<MaterialLayer>(randomEngine() % 2);
+		const SpriteBlendMode pass = static_cast<SpriteBlendMode>(randomEngine() % SPRITE_BLEND_MODE_COUNT);
+		const bool bPointSprite = pass == SPRITE_BLEND_OPAQUE && randomEngine() % 8 == 0;
+		const uint16_t materialID = static_cast<uint16_t>(randomEngine() % SORT_BENCHMARK_MATERIAL_COUNT);
+
+		const int itemIndex = pass == SPRITE_BLEND_TRANSLUCENT ? --backItemIndex : frontItemCount++;
+		sourceItems[itemIndex] = { GetSpriteSortKey(cacheLayer, layer, pass, bPointSprite, materialID), static_cast<uint32_t>(i) };
+	}
+
+	std::vector<double> sortTimes;
+
+	for (int run = 0; run < SORT_BENCHMARK_RUN_COUNT; ++run)
+	{
+		std::copy(sourceItems.get(), sourceItems.get() + SORT_BENCHMARK_ITEM_COUNT, items.get());
+
+		const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+		RadixSort(items.get(), scratch.get(), SORT_BENCHMARK_ITEM_COUNT, SPRITE_SORT_KEY_BIT_COUNT);
+		sortTimes.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count());
+	}
+
+	std::sort(sortTimes.begin(), sortTimes.end());
+
+	printf("Sort benchmark: %d items, %d key bits on %u threads, %.3f ms median (min %.3f ms, max %.3f ms) over %d runs\n"
+		, SORT_BENCHMARK_ITEM_COUNT
+		, SPRITE_SORT_KEY_BIT_COUNT
+		, GetJobThreadCount()
+		, sortTimes[sortTimes.size() / 2]
+		, sortTimes.front()
+		, sortTimes.back()
+		, SORT_BENCHMARK_RUN_COUNT);
+
+	ShutdownJobPool();
+
+	return 0;
+}
+
+void InitializeGlesBackend(uint32_t maxInstanceCount)
+{
+	GL_CALL(glViewport(0, 0, RenderWidth, RenderHeight));
+
+	//    GlStateCache ļ   ٽ ϴ ȣ ǳʶݴϴ.
+	ResetGlStateCache();
+	SetGlCapability(GL_DEPTH_TEST, true);
+
+	/*
+		̴ ʱȭմϴ.
+		    ۸ صΰ  Ȯ ʽϴ. ̹ ϴ  ؽó  нϴ.
+		KHR_parallel_shader_compile ϸ ̹   ϰ   ʰ   ֽϴ.
+	*/
+	{
+		bParallelShaderCompileSupported = IsGlExtensionSupported("GL_KHR_parallel_shader_compile");
+
+		if (bParallelShaderCompileSupported)
+		{
+			const auto glMaxShaderCompilerThreadsKHR = reinterpret_cast<PFNGLMAXSHADERCOMPILERTHREADSKHRPROC>(eglGetProcAddress("glMaxShaderCompilerThreadsKHR"));
+
+			// 0xFFFFFFFF   ̹ ϰ մϴ.
+			if (glMaxShaderCompilerThreadsKHR != nullptr)
+			{
+				GL_CALL(glMaxShaderCompilerThreadsKHR(0xFFFFFFFF));
+			}
+		}
+
+		ShaderProgram = BeginShaderProgram("Shaders/SpriteVS.glsl", "Shaders/SpriteFS.glsl");
+
+		//  ׸Ʈ ̴  ׽Ʈ  Դϴ.
+		OpaqueShaderProgram = BeginShaderProgram("Shaders/SpriteVS.glsl", "Shaders/SpriteFS.glsl", "#define OPAQUE\n");
+
+		CompositeShaderProgram = BeginShaderProgram("Shaders/CompositeVS.glsl", "Shaders/CompositeFS.glsl");
+
+		PointShaderProgram = BeginShaderProgram("Shaders/SpritePointVS.glsl", "Shaders/SpritePointFS.glsl");
+	}
+
+	// gl_PointSize ̹ ִ ũ ߸Ƿ ׺ ū Ʈ  ׸ ʽϴ. OpenGLES 1 ̻ մϴ.
+	{
+		GLfloat pointSizeRange[2] = {};
+		GL_CALL(glGetFloatv(GL_ALIASED_POINT_SIZE_RANGE, pointSizeRange));
+
+		PointSpriteLodSize = std::min(POINT_SPRITE_LOD_SIZE, std::max(pointSizeRange[1], 1.0f));
+	}
+
+	//  ¸ ʱȭմϴ.
+	{
+		const float vertices[] =
+		{
+			1.0f, 1.0f,
+			1.0f, 0.0f,
+			0.0f, 0.0f,
+			0.0f, 1.0f
+		};
+
+		const uint32_t indices[] =
+		{
+			0, 1, 3,
+			1, 2, 3
+		};
+
+		GL_CALL(glGenVertexArrays(1, &VAO));
+		BindGlVertexArray(VAO);
+
+		GL_CALL(glGenBuffers(1, &VBO));
+		BindGlBuffer(GL_ARRAY_BUFFER, VBO);
+		GL_CALL(glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW));
+		TrackGpuMemoryAllocation(GPU_MEMORY_GEOMETRY, VBO, sizeof(vertices));
+
+		//  Ͱ  ̴ ˷ݴϴ.
+		GL_CALL(glEnableVertexAttribArray(0));
+		GL_CALL(glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), nullptr));
+
+		GL_CALL(glGenBuffers(1, &EBO));
+		BindGlBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+		GL_CALL(glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW));
+		TrackGpuMemoryAllocation(GPU_MEMORY_GEOMETRY, EBO, sizeof(indices));
+	}
+
+	// ProjectionViewWorldVBO  ̴ ˷ݴϴ.
+	{
+		GL_CALL(glGenBuffers(1, &ProjectionViewWorldVBO));
+		BindGlBuffer(GL_ARRAY_BUFFER, ProjectionViewWorldVBO);
+
+		for (int i = 1; i <= 4; i++)
+		{
+			GL_CALL(glEnableVertexAttribArray(i));
+			GL_CALL(glVertexAttribDivisor(i, 1));
+		}
+
+		GL_CALL(glBufferData(GL_ARRAY_BUFFER, sizeof(mat4) * maxInstanceCount, nullptr, GL_DYNAMIC_DRAW));
+		TrackGpuMemoryAllocation(GPU_MEMORY_INSTANCE_BUFFER, ProjectionViewWorldVBO, sizeof(mat4) * maxInstanceCount);
+	}
+
+	// TextureAttributeVBO  ̴ ˷ݴϴ.
+	{
+		GL_CALL(glGenBuffers(1, &TextureAttributeVBO));
+		BindGlBuffer(GL_ARRAY_BUFFER, TextureAttributeVBO);
+
+		GL_CALL(glEnableVertexAttribArray(5));
+		GL_CALL(glVertexAttribDivisor(5, 1));
+
+		GL_CALL(glBufferData(GL_ARRAY_BUFFER, sizeof(uvec4) * maxInstanceCount, nullptr, GL_DYNAMIC_DRAW));
+		TrackGpuMemoryAllocation(GPU_MEMORY_INSTANCE_BUFFER, TextureAttributeVBO, sizeof(uvec4) * maxInstanceCount);
+	}
+
+	// SpriteStyleVBO  ̴ ˷ݴϴ.
+	{
+		GL_CALL(glGenBuffers(1, &SpriteStyleVBO));
+		BindGlBuffer(GL_ARRAY_BUFFER, SpriteStyleVBO);
+
+		GL_CALL(glEnableVertexAttribArray(6));
+		GL_CALL(glVertexAttribDivisor(6, 1));
+
+		GL_CALL(glBufferData(GL_ARRAY_BUFFER, sizeof(uvec4) * maxInstanceCount, nullptr, GL_DYNAMIC_DRAW));
+		TrackGpuMemoryAllocation(GPU_MEMORY_INSTANCE_BUFFER, SpriteStyleVBO, sizeof(uvec4) * maxInstanceCount);
+	}
+
+	SetInstanceAttributePointers(0);
+
+	// Ŭ 簢 ǥ ̴ 0   ε մϴ. ε ٲ Ƿ   մϴ.
+	{
+		GL_CALL(glGenBuffers(1, &ClipRectUBO));
+		BindGlBuffer(GL_UNIFORM_BUFFER, ClipRectUBO);
+
+		GL_CALL(glBufferData(GL_UNIFORM_BUFFER, sizeof(UploadedClipRects), UploadedClipRects, GL_DYNAMIC_DRAW));
+		TrackGpuMemoryAllocation(GPU_MEMORY_INSTANCE_BUFFER, ClipRectUBO, sizeof(UploadedClipRects));
+
+		GL_CALL(glBindBufferBase(GL_UNIFORM_BUFFER, 0, ClipRectUBO));
+	}
+
+	//  ̽ ׵θ ǥ 1 εԴϴ.
+	{
+		GL_CALL(glGenBuffers(1, &NineSliceBorderUBO));
+		BindGlBuffer(GL_UNIFORM_BUFFER, NineSliceBorderUBO);
+
+		GL_CALL(glBufferData(GL_UNIFORM_BUFFER, sizeof(UploadedNineSliceBorders), UploadedNineSliceBorders, GL_DYNAMIC_DRAW));
+		TrackGpuMemoryAllocation(GPU_MEMORY_INSTANCE_BUFFER, NineSliceBorderUBO, sizeof(UploadedNineSliceBorders));
+
+		GL_CALL(glBindBufferBase(GL_UNIFORM_BUFFER, 1, NineSliceBorderUBO));
+	}
+
+	/*
+		ٲ  ٽ ׸    ־ մϴ.
+		⺻  ۴      Ƿ    ۿ ׸    ȭ մϴ.
+		ػ󵵸      Ϻο ׸ ϸ鼭 øϴ.
+	*/
+	if (DIRTY_RECT_REDRAW || DYNAMIC_RESOLUTION)
+	{
+		GL_CALL(glGenRenderbuffers(1, &SceneColorRenderbuffer));
+		GL_CALL(glBindRenderbuffer(GL_RENDERBUFFER, SceneColorRenderbuffer));
+		GL_CALL(glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, SCREEN_WIDTH, SCREEN_HEIGHT));
+		TrackGpuMemoryAllocation(GPU_MEMORY_RENDER_TARGET, SceneColorRenderbuffer, 4 * SCREEN_WIDTH * SCREEN_HEIGHT);
+
+		GL_CALL(glGenRenderbuffers(1, &SceneDepthRenderbuffer));
+		GL_CALL(glBindRenderbuffer(GL_RENDERBUFFER, SceneDepthRenderbuffer));
+		GL_CALL(glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, SCREEN_WIDTH, SCREEN_HEIGHT));
+		TrackGpuMemoryAllocation(GPU_MEMORY_RENDER_TARGET, SceneDepthRenderbuffer, 4 * SCREEN_WIDTH * SCREEN_HEIGHT);
+
+		GL_CALL(glGenFramebuffers(1, &SceneFramebuffer));
+		BindGlFramebuffer(SceneFramebuffer);
+
+		GL_CALL(glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, SceneColorRenderbuffer));
+		GL_CALL(glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, SceneDepthRenderbuffer));
+
+		assert(glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE && "Scene framebuffer is incomplete");
+
+		BindGlFramebuffer(0);
+	}
+
+	// Ÿ̸  64Ʈ  д Լ Ȯ Լ̹Ƿ  ɴϴ.  潺 ϴ.
+	if (DYNAMIC_RESOLUTION)
+	{
+		bGpuTimerQuerySupported = IsGlExtensionSupported("GL_EXT_disjoint_timer_query");
+
+		if (bGpuTimerQuerySupported)
+		{
+			GlGetQueryObjectui64vEXT = reinterpret_cast<PFNGLGETQUERYOBJECTUI64VEXTPROC>(eglGetProcAddress("glGetQueryObjectui64vEXT"));
+			bGpuTimerQuerySupported = GlGetQueryObjectui64vEXT != nullptr;
+		}
+
+		if (bGpuTimerQuerySupported)
+		{
+			for (GpuFrameTimer& timer : GpuFrameTimers)
+			{
+				GL_CALL(glGenQueries(1, &timer.Query));
+			}
+		}
+	}
+}
+
+void ShutdownGlesBackend()
+{
+	for (GpuFrameTimer& timer : GpuFrameTimers)
+	{
+		if (timer.Fence != nullptr)
+		{
+			GL_CALL(glDeleteSync(timer.Fence));
+			timer.Fence = nullptr;
+			timer.bPending = false;
+		}
+	}
+
+	if (bGpuTimerQuerySupported)
+	{
+		for (GpuFrameTimer& timer : GpuFrameTimers)
+		{
+			GL_CALL(glDeleteQueries(1, &timer.Query));
+			timer = {};
+		}
+
+		bGpuTimerQuerySupported = false;
+	}
+
+	if (SceneFramebuffer != 0)
+	{
+		DeleteGlFramebuffer(&SceneFramebuffer);
+
+		GL_CALL(glDeleteRenderbuffers(1, &SceneColorRenderbuffer));
+		TrackGpuMemoryRelease(GPU_MEMORY_RENDER_TARGET, SceneColorRenderbuffer);
+
+		GL_CALL(glDeleteRenderbuffers(1, &SceneDepthRenderbuffer));
+		TrackGpuMemoryRelease(GPU_MEMORY_RENDER_TARGET, SceneDepthRenderbuffer);
+
+		SceneFramebuffer = 0;
+		SceneColorRenderbuffer = 0;
+		SceneDepthRenderbuffer = 0;
+	}
+
+	for (uint32_t i = 0; i < CACHED_LAYER_COUNT; ++i)
+	{
+		if (LayerFramebuffers[i] != 0)
+		{
+			DeleteGlFramebuffer(&LayerFramebuffers[i]);
+			DeleteGlTexture(&LayerTextures[i]);
+			TrackGpuMemoryRelease(GPU_MEMORY_RENDER_TARGET, LayerTextures[i]);
+
+			LayerFramebuffers[i] = 0;
+			LayerTextures[i] = 0;
+		}
+	}
+
+	if (LayerDepthRenderbuffer != 0)
+	{
+		GL_CALL(glDeleteRenderbuffers(1, &LayerDepthRenderbuffer));
+		TrackGpuMemoryRelease(GPU_MEMORY_RENDER_TARGET, LayerDepthRenderbuffer);
+		LayerDepthRenderbuffer = 0;
+	}
+
+	DeleteGlTexture(&TextureArray);
+	TrackGpuMemoryRelease(GPU_MEMORY_TEXTURE_ARRAY, TextureArray);
+
+	DeleteGlBuffer(&NineSliceBorderUBO);
+	TrackGpuMemoryRelease(GPU_MEMORY_INSTANCE_BUFFER, NineSliceBorderUBO);
+
+	DeleteGlBuffer(&ClipRectUBO);
+	TrackGpuMemoryRelease(GPU_MEMORY_INSTANCE_BUFFER, ClipRectUBO);
+
+	DeleteGlBuffer(&SpriteStyleVBO);
+	TrackGpuMemoryRelease(GPU_MEMORY_INSTANCE_BUFFER, SpriteStyleVBO);
+
+	DeleteGlBuffer(&TextureAttributeVBO);
+	TrackGpuMemoryRelease(GPU_MEMORY_INSTANCE_BUFFER, TextureAttributeVBO);
+
+	DeleteGlBuffer(&ProjectionViewWorldVBO);
+	TrackGpuMemoryRelease(GPU_MEMORY_INSTANCE_BUFFER, ProjectionViewWorldVBO);
+
+	DeleteGlBuffer(&EBO);
+	TrackGpuMemoryRelease(GPU_MEMORY_GEOMETRY, EBO);
+
+	DeleteGlBuffer(&VBO);
+	TrackGpuMemoryRelease(GPU_MEMORY_GEOMETRY, VBO);
+
+	DeleteGlVertexArray(&VAO);
+	//      ̴  ֽϴ.
+	for (const ShaderProgramBuild& build : PendingShaderPrograms)
+	{
+		GL_CALL(glDeleteShader(build.VertexShader));
+		GL_CALL(glDeleteShader(build.FragmentShader));
+	}
+
+	PendingShaderPrograms.clear();
+
+	GL_CALL(glDeleteProgram(ShaderProgram));
+	GL_CALL(glDeleteProgram(OpaqueShaderProgram));
+	GL_CALL(glDeleteProgram(CompositeShaderProgram));
+	GL_CALL(glDeleteProgram(PointShaderProgram));
+}
+
+void CreateGlesTextureArray(uint32_t format, uint32_t width, uint32_t height, uint32_t layerCount)
+{
+	//  ε ٽ    ؽó ̸  ϴ.
+	if (TextureArray != 0)
+	{
+		DeleteGlTexture(&TextureArray);
+		TrackGpuMemoryRelease(GPU_MEMORY_TEXTURE_ARRAY, TextureArray);
+	}
+
+	//  ػ RGBA8 ̴ ؼ ǥ  ٿ Ƿ  ּҸ ״ մϴ.
+	const GLsizei textureArrayScale = format == GL_RGBA8 ? 2 : 1;
+
+	GL_CALL(glGenTextures(1, &TextureArray));
+	BindGlTexture(0, GL_TEXTURE_2D_ARRAY, TextureArray);
+
+	GL_CALL(glTexStorage3D(GL_TEXTURE_2D_ARRAY, 1, format
+		, width / textureArrayScale, height / textureArrayScale, layerCount));
+
+	//    ϳ 16Ʈ̹Ƿ ũ ̹ ۿ ϴ.
+	TrackGpuMemoryAllocation(GPU_MEMORY_TEXTURE_ARRAY, TextureArray, static_cast<size_t>(width) * height * layerCount);
+
+	GL_CALL(glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_REPEAT));
+	GL_CALL(glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_REPEAT));
+	GL_CALL(glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_NEAREST));
+	GL_CALL(glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_NEAREST));
+
+	//  ġ  ũ   ߹Ƿ  غ  α׷ غ  մϴ.
+	TexelShift = textureArrayScale / 2;
+
+	for (const GLuint shaderProgram : { ShaderProgram, OpaqueShaderProgram, CompositeShaderProgram })
+	{
+		if (IsShaderProgramPending(shaderProgram) == false)
+		{
+			ApplyTextureArrayUniforms(shaderProgram);
+		}
+	}
+}
+
+void BeginGlesFrame(bool bPreserveContents)
+{
+	BindGlFramebuffer(SceneFramebuffer);
+
+	if (DYNAMIC_RESOLUTION)
+	{
+		BeginGpuFrameTimer(bPreserveContents == false);
+	}
+
+	//   ϸ BeginGlesRegion  ϴ.
+	if (bPreserveContents == false)
+	{
+		glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+	}
+
+	PollShaderPrograms();
+}
+
+void UploadGlesInstances(const mat4* projectionViewWorlds, const uvec4* textureAttributes, const uvec4* spriteStyles, uint32_t instanceCount)
+{
+	// glMapBufferRange ̰ 0̸  ϴ.
+	if (instanceCount == 0)
+	{
+		return;
+	}
+
+	//  ޸𸮿 ProjectionViewWorld ͸ մϴ.
+	{
+		BindGlBuffer(GL_ARRAY_BUFFER, ProjectionViewWorldVBO);
+
+		// glMapBufferOES Ȯ̶ ̺귯    Ƿ 3.0 ھ Լ մϴ.
+		void* dataPtr = GL_CALL(glMapBufferRange(GL_ARRAY_BUFFER, 0, sizeof(mat4) * instanceCount, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT));
+		memcpy(dataPtr, projectionViewWorlds, sizeof(mat4) * instanceCount);
+
+		GL_CALL(glUnmapBuffer(GL_ARRAY_BUFFER));
+	}
+
+	//  ޸𸮿 TextureAttribute ͸ մϴ.
+	{
+		BindGlBuffer(GL_ARRAY_BUFFER, TextureAttributeVBO);
+
+		void* dataPtr = GL_CALL(glMapBufferRange(GL_ARRAY_BUFFER, 0, sizeof(uvec4) * instanceCount, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT));
+		memcpy(dataPtr, textureAttributes, sizeof(uvec4) * instanceCount);
+
+		GL_CALL(glUnmapBuffer(GL_ARRAY_BUFFER));
+	}
+
+	//  ޸𸮿 SpriteStyle ͸ մϴ.
+	{
+		BindGlBuffer(GL_ARRAY_BUFFER, SpriteStyleVBO);
+
+		void* dataPtr = GL_CALL(glMapBufferRange(GL_ARRAY_BUFFER, 0, sizeof(uvec4) * instanceCount, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT));
+		memcpy(dataPtr, spriteStyles, sizeof(uvec4) * instanceCount);
+
+		GL_CALL(glUnmapBuffer(GL_ARRAY_BUFFER));
+	}
+}
+
+void UploadGlesClipRects(const ScreenRect* rects, uint32_t rectCount)
+{
+	assert(rectCount <= MAX_CLIP_RECT_COUNT);
+
+	// ̴  ġ ٷ   ֵ ȭ ġ ǥ ٲߴϴ. ĳ ̾ ȭ  ũԴϴ.
+	vec4 clipRects[MAX_CLIP_RECT_COUNT];
+
+	for (uint32_t i = 1; i < rectCount; ++i)
+	{
+		const ScreenRect& rect = rects[i];
+
+		clipRects[i] = vec4(
+			rect.X * 2.0f / SCREEN_WIDTH - 1.0f
+			, rect.Y * 2.0f / SCREEN_HEIGHT - 1.0f
+			, (rect.X + rect.Width) * 2.0f / SCREEN_WIDTH - 1.0f
+			, (rect.Y + rect.Height) * 2.0f / SCREEN_HEIGHT - 1.0f);
+	}
+
+	// ũ ʴ ӿ  ̹Ƿ ø ʽϴ.
+	if (rectCount <= 1 || memcmp(&clipRects[1], &UploadedClipRects[1], sizeof(vec4) * (rectCount - 1)) == 0)
+	{
+		return;
+	}
+
+	std::copy(clipRects + 1, clipRects + rectCount, UploadedClipRects + 1);
+
+	BindGlBuffer(GL_UNIFORM_BUFFER, ClipRectUBO);
+	GL_CALL(glBufferSubData(GL_UNIFORM_BUFFER, sizeof(vec4), sizeof(vec4) * (rectCount - 1), &UploadedClipRects[1]));
+}
+
+void UploadGlesNineSliceBorders(const NineSliceBorder* borders, uint32_t borderCount)
+{
+	assert(borderCount <= MAX_NINE_SLICE_BORDER_COUNT);
+
+	// ̴  ׵θ(, Ʒ)  ׵θ(, )  vec2 нϴ.
+	vec4 nineSliceBorders[MAX_NINE_SLICE_BORDER_COUNT];
+
+	for (uint32_t i = 1; i < borderCount; ++i)
+	{
+		nineSliceBorders[i] = vec4(borders[i].Left, borders[i].Bottom, borders[i].Right, borders[i].Top);
+	}
+
+	// ׵θ  ڿ ٲ Ƿ κ ӿ ø ʽϴ.
+	if (borderCount <= 1 || memcmp(&nineSliceBorders[1], &UploadedNineSliceBorders[1], sizeof(vec4) * (borderCount - 1)) == 0)
+	{
+		return;
+	}
+
+	std::copy(nineSliceBorders + 1, nineSliceBorders + borderCount, UploadedNineSliceBorders + 1);
+
+	BindGlBuffer(GL_UNIFORM_BUFFER, NineSliceBorderUBO);
+	GL_CALL(glBufferSubData(GL_UNIFORM_BUFFER, sizeof(vec4), sizeof(vec4) * (borderCount - 1), &UploadedNineSliceBorders[1]));
+}
+
+void DrawGlesSprites(const SpriteDrawState& drawState, uint32_t firstInstance, uint32_t instanceCount)
+{
+	ApplyMaterial(drawState);
+
+	if (drawState.bPointSprites)
+	{
+		DrawSpritePointInstances(static_cast<GLsizei>(firstInstance), static_cast<GLsizei>(instanceCount));
+	}
+	else
+	{
+		DrawSpriteInstances(static_cast<GLsizei>(firstInstance), static_cast<GLsizei>(instanceCount));
+	}
+}
+
+void BeginGlesLayer(uint32_t layer)
+{
+	assert(layer < CACHED_LAYER_COUNT);
+
+	if (LayerFramebuffers[layer] == 0)
+	{
+		CreateLayerTarget(layer);
+	}
+
+	BindGlFramebuffer(LayerFramebuffers[layer]);
+
+	//    ռ  ׸  ȼ ȭ ٲ ʽϴ.
+	SetGlDepthMask(true);
+
+	glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+}
+
+void EndGlesLayer()
+{
+	ResetRenderState();
+
+	// ̴ ̾ ׸ ȿ ʿϹǷ Ÿ  GPU ޸𸮿  ʰ մϴ.
+	const GLenum depthAttachment = GL_DEPTH_ATTACHMENT;
+	GL_CALL(glInvalidateFramebuffer(GL_FRAMEBUFFER, 1, &depthAttachment));
+
+	BindGlFramebuffer(SceneFramebuffer);
+}
+
+void DrawGlesLayer(uint32_t layer)
+{
+	assert(layer < CACHED_LAYER_COUNT && LayerTextures[layer] != 0);
+
+	if (CurrentRenderState.ShaderProgram != CompositeShaderProgram)
+	{
+		FinishShaderProgram(CompositeShaderProgram);
+
+		CurrentRenderState.ShaderProgram = CompositeShaderProgram;
+		CurrentRenderState.MaterialID = -1;
+	}
+
+	UseGlProgram(CompositeShaderProgram);
+
+	// ̴ ÷ ⺻ 0  մϴ. ؽó ̿  ޶  ֿ Բ εǾ ־ ˴ϴ.
+	BindGlTexture(0, GL_TEXTURE_2D, LayerTextures[layer]);
+	SetGlCapability(GL_BLEND, true);
+	SetGlBlendFuncSeparate(GL_ONE, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+	SetGlCapability(GL_DEPTH_TEST, false);
+
+	// Ʈ VAO 0~1 簢 ״ մϴ. νϽ Ӽ ̴  ʽϴ.
+	GL_CALL(glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0));
+}
+
+void BeginGlesRegion(const ScreenRect& rect)
+{
+	//   ȼ   ״   ׸⸦   ڸϴ.
+	// ػ󵵸  ߽  ȿ ִ ȼ ٲߴϴ.  ģ νϽ ׸Ƿ  ȼ  ٽ ׷ϴ.
+	const GLint minX = static_cast<GLint>(std::ceil(rect.X * RenderScale - 0.5f));
+	const GLint minY = static_cast<GLint>(std::ceil(rect.Y * RenderScale - 0.5f));
+	const GLint maxX = static_cast<GLint>(std::ceil((rect.X + rect.Width) * RenderScale - 0.5f));
+	const GLint maxY = static_cast<GLint>(std::ceil((rect.Y + rect.Height) * RenderScale - 0.5f));
+
+	SetGlCapability(GL_SCISSOR_TEST, true);
+	SetGlScissor(minX, minY, maxX - minX, maxY - minY);
+	SetGlDepthMask(true);
+
+	glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+}
+
+void EndGlesRegion()
+{
+	SetGlCapability(GL_SCISSOR_TEST, false);
+}
+
+void EndGlesFrame()
+{
+	//   glClear  ۸   ֵ  ⸦ ǵϴ.
+	ResetRenderState();
+
+	if (SceneFramebuffer != 0)
+	{
+		// ̴  ӿ  ٽ Ƿ  ʽϴ.
+		const GLenum depthAttachment = GL_DEPTH_ATTACHMENT;
+		GL_CALL(glInvalidateFramebuffer(GL_FRAMEBUFFER, 1, &depthAttachment));
+
+		BindGlFramebuffer(0);
+
+		//  ĳô б ⸦ Բ ε  ϹǷ   б  ǵϴ.
+		//  ػ󵵷 ׷ ȭ ũ ø鼭  ɷ մϴ.
+		const GLenum filter = RenderWidth == SCREEN_WIDTH && RenderHeight == SCREEN_HEIGHT ? GL_NEAREST : GL_LINEAR;
+
+		GL_CALL(glBindFramebuffer(GL_READ_FRAMEBUFFER, SceneFramebuffer));
+		GL_CALL(glBlitFramebuffer(0, 0, RenderWidth, RenderHeight, 0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, GL_COLOR_BUFFER_BIT, filter));
+		GL_CALL(glBindFramebuffer(GL_READ_FRAMEBUFFER, 0));
+	}
+
+	if (DYNAMIC_RESOLUTION)
+	{
+		EndGpuFrameTimer();
+	}
+
+	EndGlStateCacheFrame();
+}
+
+void PrintGlesStats(FILE* stream)
+{
+	PrintGlStateCacheStats(stream);
+	PrintDynamicResolutionStats(stream);
+}
+
+void UpdateDynamicResolution()
+{
+	PollGpuFrameTimers();
+
+	//   ̰ ð Ѵٰ       ϴ.
+	if (SmoothedGpuFrameTime > GPU_FRAME_TIME_BUDGET && RenderScale > MIN_RENDER_SCALE)
+	{
+		const float fittedScale = RenderScale * static_cast<float>(std::sqrt(GPU_FRAME_TIME_BUDGET / SmoothedGpuFrameTime));
+		const float steppedScale = std::floor(fittedScale / RENDER_SCALE_STEP + 0.001f) * RENDER_SCALE_STEP;
+
+		SetRenderScale(std::max(std::min(steppedScale, RenderScale - RENDER_SCALE_STEP), MIN_RENDER_SCALE));
+	}
+	else if (RenderScaleHeadroomFrameCount >= RENDER_SCALE_RAISE_DELAY && RenderScale < 1.0f)
+	{
+		if (bRenderScaleFullFrameHeadroom)
+		{
+			SetRenderScale(std::min(RenderScale + RENDER_SCALE_STEP, 1.0f));
+		}
+		else if (RenderScaleProbeFrameCount >= RENDER_SCALE_PROBE_INTERVAL)
+		{
+			// ٲ  ׸ ȿ ü    Ƿ   ü ٽ ׷ ϴ.
+			bSpriteFootprintsValid = false;
+			RenderScaleProbeFrameCount = 0;
+			++ResolutionStats.ProbeCount;
+		}
+		else
+		{
+			++RenderScaleProbeFrameCount;
+		}
+	}
+}
+
+void PollGpuFrameTimers()
+{
+	//   潺   нϴ.    ʾ  ͵  ʾҽϴ.
+	GLint bDisjoint = 0;
+
+	if (bGpuTimerQuerySupported)
+	{
+		GL_CALL(glGetIntegerv(GL_GPU_DISJOINT_EXT, &bDisjoint));
+	}
+
+	const std::chrono::steady_clock::time_point pollTime = std::chrono::steady_clock::now();
+
+	for (uint32_t i = 0; i < GPU_FRAME_TIMER_COUNT; ++i)
+	{
+		GpuFrameTimer& timer = GpuFrameTimers[(GpuFrameTimerIndex + i) % GPU_FRAME_TIMER_COUNT];
+
+		if (timer.bPending == false)
+		{
+			continue;
+		}
+
+		if (bGpuTimerQuerySupported)
+		{
+			GLuint bAvailable = 0;
+			GL_CALL(glGetQueryObjectuiv(timer.Query, GL_QUERY_RESULT_AVAILABLE, &bAvailable));
+
+			if (bAvailable == 0)
+			{
+				break;
+			}
+
+			GLuint64 elapsedTime = 0;
+			GL_CALL(GlGetQueryObjectui64vEXT(timer.Query, GL_QUERY_RESULT, &elapsedTime));
+			timer.bPending = false;
+
+			//  ̿ GPU ٸ(, Ŭ  )    Ƿ ϴ.
+			if (bDisjoint == 0)
+			{
+				AddGpuFrameTime(elapsedTime * 1e-9, elapsedTime * 1e-9, timer.RenderScale, timer.bFullFrame);
+			}
+
+			continue;
+		}
+
+		// ð  0 ָ ٸ ʰ ¸ Ȯմϴ.
+		const GLenum waitResult = GL_CALL(glClientWaitSync(timer.Fence, 0, 0));
+
+		if (waitResult == GL_TIMEOUT_EXPIRED)
+		{
+			// ڿ  潺  ȣ ʾҽϴ.
+			for (uint32_t j = i; j < GPU_FRAME_TIMER_COUNT; ++j)
+			{
+				GpuFrameTimer& laterTimer = GpuFrameTimers[(GpuFrameTimerIndex + j) % GPU_FRAME_TIMER_COUNT];
+
+				if (laterTimer.bPending)
+				{
+					laterTimer.UnsignaledTime = pollTime;
+				}
+			}
+
+			break;
+		}
+
+		GL_CALL(glDeleteSync(timer.Fence));
+		timer.Fence = nullptr;
+		timer.bPending = false;
+
+		if (waitResult == GL_WAIT_FAILED)
+		{
+			continue;
+		}
+
+		/*
+			潺  ȣ     ð ȣ  ó  ð ̿ ȣǾϴ.
+			GPU    ð   潺 ȣ ð   ʿ   մϴ.
+			     ߴ   Ƿ  ʰԴ  潺 ȣǱ  ϴ.
+			 ϴ CPU ð  ׸ ȣ    Ƿ ۽ϴ.
+		*/
+		const bool bPreviousFrameSignaled = GpuFenceSignaledFrameNumber + 1 == timer.FrameNumber;
+		const std::chrono::steady_clock::time_point earliestStartTime = bPreviousFrameSignaled ? std::max(timer.BeginTime, GpuFenceSignaledAfter) : timer.BeginTime;
+		const std::chrono::steady_clock::time_point latestStartTime = bPreviousFrameSignaled ? std::max(timer.BeginTime, GpuFenceSignaledBefore) : timer.UnsignaledTime;
+
+		const double minGpuFrameTime = std::max(std::chrono::duration<double>(timer.UnsignaledTime - latestStartTime).count(), 0.0);
+		const double maxGpuFrameTime = std::chrono::duration<double>(pollTime - earliestStartTime).count();
+
+		GpuFenceSignaledFrameNumber = timer.FrameNumber;
+		GpuFenceSignaledAfter = timer.UnsignaledTime;
+		GpuFenceSignaledBefore = pollTime;
+
+		AddGpuFrameTime(minGpuFrameTime, maxGpuFrameTime, timer.RenderScale, timer.bFullFrame);
+	}
+}
+
+bool IsGpuFencePending()
+{
+	if (bGpuTimerQuerySupported)
+	{
+		return false;
+	}
+
+	for (const GpuFrameTimer& timer : GpuFrameTimers)
+	{
+		if (timer.bPending)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void SetRenderScale(float renderScale)
+{
+	assert(renderScale >= MIN_RENDER_SCALE && renderScale <= 1.0f);
+
+	if (renderScale == RenderScale)
+	{
+		return;
+	}
+
+	if (renderScale < RenderScale)
+	{
+		++ResolutionStats.LoweredCount;
+	}
+	else
+	{
+		++ResolutionStats.RaisedCount;
+	}
+
+	ResolutionStats.MinRenderScale = std::min(ResolutionStats.MinRenderScale, renderScale);
+
+	// ̵    ̷ ȯؼ ̾ϴ. ø    ٽ ϴ.
+	SmoothedGpuFrameTime *= (renderScale / RenderScale) * (renderScale / RenderScale);
+	RenderScaleHeadroomFrameCount = 0;
+	bRenderScaleFullFrameHeadroom = false;
+	RenderScaleProbeFrameCount = RENDER_SCALE_PROBE_INTERVAL;
+
+	RenderScale = renderScale;
+	RenderWidth = std::max(static_cast<GLsizei>(std::lround(SCREEN_WIDTH * renderScale)), 1);
+	RenderHeight = std::max(static_cast<GLsizei>(std::lround(SCREEN_HEIGHT * renderScale)), 1);
+
+	// ĳ ̾  Ʈ ׸Ƿ ռ  gl_FragCoord ״ ̾ ؼ ġԴϴ.
+	GL_CALL(glViewport(0, 0, RenderWidth, RenderHeight));
+
+	if (IsShaderProgramPending(PointShaderProgram) == false)
+	{
+		ApplyViewportSizeUniform(PointShaderProgram);
+	}
+
+	//  ȭ ̾   ׷ Ƿ    ٽ ׸ϴ.
+	bSpriteFootprintsValid = false;
+
+	for (uint32_t layer = 0; layer < CACHED_LAYER_COUNT; ++layer)
+	{
+		RenderedCacheLayerVersions[layer] = UINT64_MAX;
+	}
+}
+
+void BeginGpuFrameTimer(bool bFullFrame)
+{
+	assert(bGpuFrameTimerActive == false);
+
+	//   潺    ʾ GPU  з ִ ̹Ƿ ̹   ʽϴ.
+	GpuFrameTimer& timer = GpuFrameTimers[GpuFrameTimerIndex];
+	++GpuFrameNumber;
+
+	if (timer.bPending)
+	{
+		return;
+	}
+
+	if (bGpuTimerQuerySupported)
+	{
+		GL_CALL(glBeginQuery(GL_TIME_ELAPSED_EXT, timer.Query));
+	}
+	else
+	{
+		timer.FrameNumber = GpuFrameNumber;
+		timer.BeginTime = std::chrono::steady_clock::now();
+	}
+
+	timer.RenderScale = RenderScale;
+	timer.bFullFrame = bFullFrame;
+	bGpuFrameTimerActive = true;
+}
+
+void EndGpuFrameTimer()
+{
+	if (bGpuFrameTimerActive == false)
+	{
+		return;
+	}
+
+	bGpuFrameTimerActive = false;
+
+	GpuFrameTimer& timer = GpuFrameTimers[GpuFrameTimerIndex];
+
+	if (bGpuTimerQuerySupported)
+	{
+		GL_CALL(glEndQuery(GL_TIME_ELAPSED_EXT));
+	}
+	else
+	{
+		// ٷ    GPU Ƿ ⼭ 潺 ְ PollGpuFrameTimers Ȯմϴ.
+		timer.Fence = GL_CALL(glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+		timer.UnsignaledTime = std::chrono::steady_clock::now();
+	}
+
+	timer.bPending = true;
+	GpuFrameTimerIndex = (GpuFrameTimerIndex + 1) % GPU_FRAME_TIMER_COUNT;
+}
+
+void AddGpuFrameTime(double minGpuFrameTime, double maxGpuFrameTime, float renderScale, bool bFullFrame)
+{
+	assert(minGpuFrameTime <= maxGpuFrameTime);
+
+	++ResolutionStats.SampleCount;
+	ResolutionStats.TotalGpuFrameTime += (minGpuFrameTime + maxGpuFrameTime) * 500.0;
+
+	//    ʰ Ƿ  ̿  ٲ   ̷ ȯմϴ.
+	// 潺     ߸  ʵ Ʒ  տ ϴ.
+	const double areaRatio = (RenderScale / renderScale) * (RenderScale / renderScale);
+	const double scaledGpuFrameTime = minGpuFrameTime * areaRatio;
+
+	if (SmoothedGpuFrameTime == 0.0)
+	{
+		SmoothedGpuFrameTime = scaledGpuFrameTime;
+	}
+	else
+	{
+		SmoothedGpuFrameTime += (scaledGpuFrameTime - SmoothedGpuFrameTime) * GPU_FRAME_TIME_SMOOTHING;
+	}
+
+	/*
+		 ܰ ÷  ð    մϴ. Ʒʵ ġ   ̰, ʵ ġ ʾƾ  ִ Դϴ.
+		ٲ  ׸  Ƿ  ̾ , ÷ Ǵ  ̿  ü  մϴ.
+	*/
+	const float raisedScale = std::min(RenderScale + RENDER_SCALE_STEP, 1.0f);
+	const double raisedAreaRatio = areaRatio * (raisedScale / RenderScale) * (raisedScale / RenderScale);
+	const double raiseLimit = GPU_FRAME_TIME_BUDGET * RENDER_SCALE_RAISE_RATIO;
+
+	if (minGpuFrameTime * raisedAreaRatio >= raiseLimit)
+	{
+		RenderScaleHeadroomFrameCount = 0;
+		bRenderScaleFullFrameHeadroom = false;
+	}
+	else if (maxGpuFrameTime * raisedAreaRatio < raiseLimit)
+	{
+		++RenderScaleHeadroomFrameCount;
+
+		if (bFullFrame)
+		{
+			bRenderScaleFullFrameHeadroom = true;
+		}
+	}
+	else if (bFullFrame)
+	{
+		//  о    ٽ   ø ʽϴ.
+		bRenderScaleFullFrameHeadroom = false;
+	}
+}
+
+void PrintDynamicResolutionStats(FILE* stream)
+{
+	assert(stream != nullptr);
+
+	if (DYNAMIC_RESOLUTION == false || ResolutionStats.SampleCount == 0)
+	{
+		return;
+	}
+
+	fprintf(stream, "Dynamic resolution: scale %.2f (%dx%d, min %.2f), lowered %u, raised %u, probed %u, GPU %.2f ms avg over %u frames (%s)\n"
+		, RenderScale
+		, RenderWidth
+		, RenderHeight
+		, ResolutionStats.MinRenderScale
+		, ResolutionStats.LoweredCount
+		, ResolutionStats.RaisedCount
+		, ResolutionStats.ProbeCount
+		, ResolutionStats.TotalGpuFrameTime / ResolutionStats.SampleCount
+		, ResolutionStats.SampleCount
+		, bGpuTimerQuerySupported ? "timer query" : "fence");
+
+	ResolutionStats = { 0, 0.0, 0, 0, 0, RenderScale };
+}
+
+void InitializeTextureAtlas()
+{
+	//  Ŷ ̴   ۸ Ҵմϴ.
+	for (FramePacket& framePacket : FramePackets)
+	{
+		framePacket.ProjectionViewWorlds = std::make_unique<mat4[]>(SPRITE_COUNT);
+		framePacket.TextureAttributes = std::make_unique<uvec4[]>(SPRITE_COUNT);
+		framePacket.SpriteStyles = std::make_unique<uvec4[]>(SPRITE_COUNT);
+		framePacket.SpriteIndices = std::make_unique<uint32_t[]>(SPRITE_COUNT);
+	}
+
+	SpriteFootprints = std::make_unique<SpriteFootprint[]>(SPRITE_COUNT);
+	bSpritesPreviouslyDrawn = std::make_unique<bool[]>(SPRITE_COUNT);
+	CulledProjectionViewWorlds = std::make_unique<mat4[]>(SPRITE_COUNT);
+	CulledTextureAttributes = std::make_unique<uvec4[]>(SPRITE_COUNT);
+	CulledSpriteStyles = std::make_unique<uvec4[]>(SPRITE_COUNT);
+
+	SpriteTextureAttributes = std::make_unique<const TextureAttribute*[]>(SPRITE_COUNT);
+	SpriteSortItems = std::make_unique<RadixSortItem[]>(SPRITE_COUNT);
+	SpriteSortScratch = std::make_unique<RadixSortItem[]>(SPRITE_COUNT);
+
+	TextureAtlas textureAtlas;
+
+	if (BuildTextureAtlas(&textureAtlas) == false)
+	{
+		assert(false && "Could not build the texture atlas");
+	}
+
+	TextureAttributes = std::move(textureAtlas.TextureAttributes);
+	UploadTextureAtlas(textureAtlas);
+	UpdateTextureArrayWasteSize();
+}
+
+bool BuildTextureAtlas(TextureAtlas* outTextureAtlas)
+{
+	/*
+		 ڵ   ߿մϴ.
+		켱  ASTC   θ ϱ  ū ۸ ϳ Ҵϰ ͸ ŵϴ.
+		׸ 512x512 ũ⸦  ؽó ʿ ŭ   ϴ.   ؽó Դϴ.
+		 ۸ ؽó ̿ մϴ.
+
+		     ̹ ϳ غ ּ
+		׸ ̹ ϳ   Ŀ  κ ߶ غκи ּ ̶ ڸ  κп   ˴ϴ.
+		׷  ̹ غκи  ̹ غǴµ     ASTC Ϸ  ּ
+		     Ͱ ɷ   Ƹ غκи ִ ASTC    ̹ ASTC  뿡  ̴ϴ.
+		   512x512  ū ̹  ̹  ִ Դϴ.
+	*/
+
+	assert(outTextureAtlas != nullptr);
+
+	size_t allAstcDataSize = 0;
+	uint32_t currentTextureArrayOffsetX = 0;
+	std::list<AstcFile> astcFiles;
+	std::list<Ktx2Image> ktx2Images;
+	bool bLoaded = true;
+
+	// Ͱ   ִ  ų ߷   Ƿ ϳ  ϸ  ʽϴ.
+	for (int i = 0; i < SPRITE_COUNT && bLoaded; ++i)
+	{
+		bLoaded = LoadTexture(Sprites[i].ImagePath.c_str(), &outTextureAtlas->TextureAttributes, &currentTextureArrayOffsetX, &allAstcDataSize, &astcFiles, &ktx2Images);
+	}
+
+	outTextureAtlas->Depth = static_cast<GLsizei>(ceilf(allAstcDataSize / static_cast<float>(TEXTURE_ARRAY_AREA)));
+	outTextureAtlas->UsedDataSize = allAstcDataSize;
+
+	//  ε  ũⰡ ٲ ؽó ڿ ̾   ֵ      Ӵϴ.
+	if (TEXTURE_HOT_RELOAD)
+	{
+		++outTextureAtlas->Depth;
+	}
+
+	const size_t imageDataSize = static_cast<size_t>(TEXTURE_ARRAY_AREA) * outTextureAtlas->Depth;
+
+	//  ASTC ͸ ϱ  ̹ Դϴ.
+	auto imageDatas = std::make_unique<uint8_t[]>(imageDataSize);
+
+	// ASTC  о ̹ ۿ մϴ.  Ͱ ª ϵ źմϴ.
+	for (const auto& astcFile : astcFiles)
+	{
+		if (bLoaded)
+		{
+			bLoaded = fseek(astcFile.data, sizeof(AstcHeader), SEEK_SET) == 0
+				&& fread(imageDatas.get() + astcFile.dataIndex, astcFile.size, 1, astcFile.data) == 1;
+		}
+
+		fclose(astcFile.data);
+	}
+
+	// KTX2 ̹ ķ  Ǯ ̹ ۿ ٷ մϴ.
+	if (bLoaded == false || ReadKtx2Images(ktx2Images, imageDatas.get()) == false)
+	{
+		return false;
+	}
+
+	// ȯϱ  ASTC ͷ ؽó ׸ İ  ׸   մϴ.
+	for (auto& textureAttribute : outTextureAtlas->TextureAttributes)
+	{
+		const uint8_t* astcData = imageDatas.get() + static_cast<size_t>(textureAttribute.second.OffsetX) * 4;
+
+		textureAttribute.second.BlendMode = ClassifyTextureBlendMode(astcData, textureAttribute.second.Width, textureAttribute.second.Height);
+		textureAttribute.second.AverageColor = ComputeTextureAverageColor(astcData, textureAttribute.second.Width, textureAttribute.second.Height);
+	}
+
+	// ü    ũ ĳø  Ȯϰ   ȯմϴ.
+	if (TextureArrayFormat != GL_COMPRESSED_RGBA_ASTC_4x4_KHR)
+	{
+		const uint64_t sourceHash = HashData(imageDatas.get(), imageDataSize);
+		auto transcodedDatas = std::make_unique<uint8_t[]>(imageDataSize);
+
+		if (LoadTranscodedTextureArray(sourceHash, transcodedDatas.get(), imageDataSize) == false)
+		{
+			TranscodeTextureArrayData(imageDatas.get(), imageDataSize, transcodedDatas.get());
+			SaveTranscodedTextureArray(sourceHash, transcodedDatas.get(), imageDataSize);
+		}
+
+		imageDatas = std::move(transcodedDatas);
+	}
+
+	outTextureAtlas->ImageData = std::move(imageDatas);
+
+	return true;
+}
+
+void UploadTextureAtlas(const TextureAtlas& textureAtlas)
+{
+	assert(textureAtlas.ImageData != nullptr);
+
+	TextureArrayDepth = textureAtlas.Depth;
+	UsedTextureArrayDataSize = textureAtlas.UsedDataSize;
+
+	Backend->CreateTextureArray(TextureArrayFormat, TEXTURE_ARRAY_WIDTH, TEXTURE_ARRAY_HEIGHT, static_cast<uint32_t>(TextureArrayDepth));
+
+	// ؽó ̿ ̹ ۸ մϴ. 帶   ö󰩴ϴ.
+	Backend->UploadTextureArrayData(0, textureAtlas.ImageData.get(), static_cast<size_t>(TEXTURE_ARRAY_AREA) * TextureArrayDepth);
+}
+
+bool RebuildTextureAtlas()
+{
+	// ũ  ٽ а ȯϴ  ùķ̼ 尡  ʵ  ʰ ϴ.
+	// ϳ  ϸ  ؽó ̸ ״ ΰ  ˸  ٽ õմϴ.
+	TextureAtlas textureAtlas;
+
+	if (BuildTextureAtlas(&textureAtlas) == false)
+	{
+		fprintf(stderr, "Could not rebuild the texture atlas\n");
+		return false;
+	}
+
+	// GL ü  常 ϹǷ ױ  øϴ.
+	const GLuint oldTextureArray = TextureArray;
+
+	UploadTextureAtlas(textureAtlas);
+
+	std::lock_guard<std::mutex> textureAttributesLock(TextureAttributesMutex);
+
+	++TextureGeneration;
+
+	TextureAttributes = std::move(textureAtlas.TextureAttributes);
+
+	for (Material& material : Materials)
+	{
+		if (material.TextureArray == oldTextureArray)
+		{
+			material.TextureArray = TextureArray;
+		}
+	}
+
+	UpdateTextureArrayWasteSize();
+
+	return true;
+}
+
+bool LoadTexture(const char* fileName, unordered_map<string, TextureAttribute>* textureAttributes, uint32_t* textureOffsetX, size_t* allAstcDataSize
+	, std::list<AstcFile>* astcFiles, std::list<Ktx2Image>* ktx2Images)
+{
+	assert(textureAttributes != nullptr);
+
+	// ̹ ϵ ؽó ϰ  ִ  ϴ  óϿ ޸  Դϴ.
+	if (textureAttributes->count(fileName) != 0)
+	{
+		return true;
+	}
+
+	uint32_t imageWidth = 0;
+	uint32_t imageHeight = 0;
+	size_t astcDataSize = 0;
+
+	// KTX2  "#̾@"  ̸ ϴ ̹   ŵϴ. (: Resources/Units.ktx2#3@1)
+	// ̾  ϸ 0 ϸ Ʈ  ϴ ̹ ؽó ̿ ϴ.
+	if (IsKtx2TextureName(fileName))
+	{
+		Ktx2Image ktx2Image;
+
+		if (LoadKtx2Image(fileName, &ktx2Image, &imageWidth, &imageHeight) == false)
+		{
+			fprintf(stderr, "Could not open %s\n", fileName);
+			return false;
+		}
+
+		astcDataSize = ktx2Image.DataSize;
+		ktx2Image.DataIndex = *allAstcDataSize;
+		ktx2Images->push_back(std::move(ktx2Image));
+	}
+	else
+	{
+		FILE* astcData = fopen(fileName, "rb");
+
+		if (astcData == nullptr || ReadAstcHeader(astcData, &imageWidth, &imageHeight, &astcDataSize) == false)
+		{
+			fprintf(stderr, "Could not open %s\n", fileName);
+
+			if (astcData != nullptr)
+			{
+				fclose(astcData);
+			}
+
+			return false;
+		}
+
+		astcFiles->push_back({ astcDataSize, astcData, *allAstcDataSize });
+	}
+
+	// ̴  ؽó Ӽ մϴ.
+	textureAttributes->insert(std::make_pair(fileName, MakeTextureAttribute(imageWidth, imageHeight, *textureOffsetX)));
+
+	// θ 4ȼ Ͽ      ؽó ؽó    ϴ.
+	imageWidth = static_cast<int>(ceilf(imageWidth / 4.0f)) * 4;
+	imageHeight = static_cast<int>(ceilf(imageHeight / 4.0f));
+
+	*textureOffsetX += imageWidth * imageHeight;
+	*allAstcDataSize += astcDataSize;
+
+	return true;
+}
+
+bool ReadAstcHeader(FILE* astcData, uint32_t* imageWidth, uint32_t* imageHeight, size_t* astcDataSize)
+{
+	assert(astcData != nullptr && imageWidth != nullptr && imageHeight != nullptr && astcDataSize != nullptr);
+
+	// ̹   ũ  ũ⸦ ɴϴ.
+	/*
+		ASTC   ڼ ˰  Ʒ ũ ϼ
+		astc : https://arm-software.github.io/opengl-es-sdk-for-android/astc_textures.html
+		⼭ ߿    ũ⸦ 4x4 ߴٴ Դϴ.
+		 ٸ  ũ⸦ ϽŴٸ main.cpp ̴ ڵ带 ϸ ˴ϴ.
+	*/
+
+	AstcHeader astcHeader;
+
+	// Ͱ   ִ   ߷   ֽϴ. 4x4  ƴ ϵ ̴   Ƿ źմϴ.
+	if (fread(&astcHeader, sizeof(AstcHeader), 1, astcData) != 1
+		|| astcHeader.magic[0] != 0x13 || astcHeader.magic[1] != 0xAB || astcHeader.magic[2] != 0xA1 || astcHeader.magic[3] != 0x5C
+		|| astcHeader.blockdim_x != 4 || astcHeader.blockdim_y != 4 || astcHeader.blockdim_z != 1)
+	{
+		return false;
+	}
+
+	*imageWidth = astcHeader.xsize[0] + (astcHeader.xsize[1] << 8) + (astcHeader.xsize[2] << 16);
+	*imageHeight = astcHeader.ysize[0] + (astcHeader.ysize[1] << 8) + (astcHeader.ysize[2] << 16);
+
+	const int xBlocks = (*imageWidth + astcHeader.blockdim_x - 1) / astcHeader.blockdim_x;
+	const int yBlocks = (*imageHeight + astcHeader.blockdim_y - 1) / astcHeader.blockdim_y;
+
+	*astcDataSize = xBlocks * yBlocks << 4;
+
+	return true;
+}
+
+TextureAttribute MakeTextureAttribute(uint32_t imageWidth, uint32_t imageHeight, uint32_t textureOffsetX)
+{
+	/*
+		ؽó ̸ 4  ()    512x4 ũ  128̰     ġԴϴ.
+		 ġ  ȣ   x ̸ θ ׸Ʈ ̴   带   ѱ ˴ϴ.
+		 ȣ  ȣ * 128 +    ȣ̹Ƿ  Ʈ   Դϴ.
+	*/
+	const uint32_t startX = textureOffsetX % TEXTURE_ARRAY_WIDTH;
+	const uint32_t startBand = textureOffsetX / TEXTURE_ARRAY_WIDTH;
+
+	return { imageWidth, imageHeight, textureOffsetX, SPRITE_BLEND_ALPHA_TEST, 0xFFFFFFFFu, uvec4(imageWidth, imageHeight, startX, startBand) };
+}
+
+SpriteBlendMode ClassifyTextureBlendMode(const uint8_t* astcData, uint32_t imageWidth, uint32_t imageHeight)
+{
+	assert(astcData != nullptr);
+
+	//  ϳ ڵϴٰ  ؼ ã ٷ ϴ.
+	//   쿡  ؼ ã  , Ʈ κ ڸ ϹǷ ù Ͽ  찡 ϴ.
+	bool bAlphaTested = false;
+
+	const uint32_t blockCountX = (imageWidth + 3) / 4;
+	const uint32_t blockCountY = (imageHeight + 3) / 4;
+
+	uint8_t texels[4 * 4 * 4];
+
+	for (uint32_t blockY = 0; blockY < blockCountY; ++blockY)
+	{
+		for (uint32_t blockX = 0; blockX < blockCountX; ++blockX)
+		{
+			DecodeAstcBlock(astcData + (blockY * blockCountX + blockX) * ASTC_BLOCK_SIZE, 4, 4, texels);
+
+			// 4ȼ  ߸鼭  ٱ ؼ ׷ Ƿ ˻ ʽϴ.
+			const uint32_t texelCountX = std::min(imageWidth - blockX * 4, 4u);
+			const uint32_t texelCountY = std::min(imageHeight - blockY * 4, 4u);
+
+			for (uint32_t y = 0; y < texelCountY; ++y)
+			{
+				for (uint32_t x = 0; x < texelCountX; ++x)
+				{
+					const uint8_t alpha = texels[(y * 4 + x) * 4 + 3];
+
+					if (alpha < ALPHA_TEST_THRESHOLD)
+					{
+						if (SPRITE_ALPHA_BLENDING == false)
+						{
+							return SPRITE_BLEND_ALPHA_TEST;
+						}
+
+						bAlphaTested = true;
+					}
+					else if (SPRITE_ALPHA_BLENDING && alpha < OPAQUE_ALPHA_THRESHOLD)
+					{
+						return SPRITE_BLEND_TRANSLUCENT;
+					}
+				}
+			}
+		}
+	}
+
+	return bAlphaTested ? SPRITE_BLEND_ALPHA_TEST : SPRITE_BLEND_OPAQUE;
+}
+
+uint32_t ComputeTextureAverageColor(const uint8_t* astcData, uint32_t imageWidth, uint32_t imageHeight)
+{
+	assert(astcData != nullptr);
+
+	//  ؼ   ʵ  ķ ؼ  ϴ. ؽó   ϹǷ   ڵմϴ.
+	uint64_t sums[4] = {};
+
+	const uint32_t blockCountX = (imageWidth + 3) / 4;
+	const uint32_t blockCountY = (imageHeight + 3) / 4;
+
+	uint8_t texels[4 * 4 * 4];
+
+	for (uint32_t blockY = 0; blockY < blockCountY; ++blockY)
+	{
+		for (uint32_t blockX = 0; blockX < blockCountX; ++blockX)
+		{
+			DecodeAstcBlock(astcData + (blockY * blockCountX + blockX) * ASTC_BLOCK_SIZE, 4, 4, texels);
+
+			const uint32_t texelCountX = std::min(imageWidth - blockX * 4, 4u);
+			const uint32_t texelCountY = std::min(imageHeight - blockY * 4, 4u);
+
+			for (uint32_t y = 0; y < texelCountY; ++y)
+			{
+				for (uint32_t x = 0; x < texelCountX; ++x)
+				{
+					const uint8_t* texel = texels + (y * 4 + x) * 4;
+
+					for (int channel = 0; channel < 3; ++channel)
+					{
+						sums[channel] += static_cast<uint64_t>(texel[channel]) * texel[3];
+					}
+
+					sums[3] += texel[3];
+				}
+			}
+		}
+	}
+
+	const uint64_t texelCount = static_cast<uint64_t>(imageWidth) * imageHeight;
+
+	if (texelCount == 0 || sums[3] == 0)
+	{
+		return 0;
+	}
+
+	uint32_t averageColor = static_cast<uint32_t>((sums[3] + texelCount / 2) / texelCount) << 24;
+
+	for (int channel = 0; channel < 3; ++channel)
+	{
+		averageColor |= static_cast<uint32_t>((sums[channel] + sums[3] / 2) / sums[3]) << (channel * 8);
+	}
+
+	return averageColor;
+}
+
+bool LoadKtx2Image(const string& textureName, Ktx2Image* outImage, uint32_t* imageWidth, uint32_t* imageHeight)
+{
+	assert(outImage != nullptr && imageWidth != nullptr && imageHeight != nullptr);
+
+	// "#̾@" ̾  ɴϴ.
+	const size_t layerPosition = textureName.find('#');
+	const size_t levelPosition = textureName.find('@', layerPosition == string::npos ? 0 : layerPosition);
+
+	outImage->Layer = layerPosition != string::npos ? static_cast<uint32_t>(strtoul(textureName.c_str() + layerPosition + 1, nullptr, 10)) : 0;
+	outImage->Level = levelPosition != string::npos ? static_cast<uint32_t>(strtoul(textureName.c_str() + levelPosition + 1, nullptr, 10)) : 0;
+
+	if (OpenKtx2File(GetTextureFilePath(textureName).c_str(), &outImage->File) == false
+		|| outImage->Layer >= outImage->File.LayerCount
+		|| outImage->Level >= outImage->File.Levels.size())
+	{
+		return false;
+	}
+
+	GetKtx2ImageSize(outImage->File, outImage->Level, imageWidth, imageHeight, &outImage->DataSize);
+
+	return true;
+}
+
+bool ReadKtx2Images(const std::list<Ktx2Image>& ktx2Images, uint8_t* imageDatas)
+{
+	/*
+		zstd   ̹Ƿ  ,    ̹     Ǳϴ.
+		 ۾ ϳ Ǹ ۾  Ǯ  óմϴ.
+		̾  ̸ ӽ   ̹ ۿ ٷ  Ǳϴ.
+	*/
+	std::map<std::pair<string, uint32_t>, std::vector<const Ktx2Image*>> levelImages;
+
+	for (const auto& ktx2Image : ktx2Images)
+	{
+		levelImages[std::make_pair(ktx2Image.File.FilePath, ktx2Image.Level)].push_back(&ktx2Image);
+	}
+
+	std::vector<const std::vector<const Ktx2Image*>*> jobs;
+
+	for (const auto& levelImage : levelImages)
+	{
+		jobs.push_back(&levelImage.second);
+	}
+
+	std::atomic<bool> bSucceeded(true);
+
+	RunJobs(static_cast<uint32_t>(jobs.size()), [&](uint32_t job)
+	{
+		const std::vector<const Ktx2Image*>& images = *jobs[job];
+		const Ktx2File& file = images.front()->File;
+		const uint32_t level = images.front()->Level;
+
+		if (file.LayerCount == 1)
+		{
+			uint8_t* levelData = imageDatas + images.front()->DataIndex;
+
+			if (ReadKtx2Level(file, level, levelData, images.front()->DataSize) == false)
+			{
+				bSucceeded = false;
+				return;
+			}
+
+			// "a.ktx2" "a.ktx2#0@0"ó ̸ ٸ  ̹ մϴ.
+			for (size_t i = 1; i < images.size(); ++i)
+			{
+				memcpy(imageDatas + images[i]->DataIndex, levelData, images[i]->DataSize);
+			}
+
+			return;
+		}
+
+		const size_t levelDataSize = GetKtx2LevelSize(file, level);
+		auto levelData = std::make_unique<uint8_t[]>(levelDataSize);
+
+		if (ReadKtx2Level(file, level, levelData.get(), levelDataSize) == false)
+		{
+			bSucceeded = false;
+			return;
+		}
+
+		for (const Ktx2Image* image : images)
+		{
+			memcpy(imageDatas + image->DataIndex, levelData.get() + image->Layer * image->DataSize, image->DataSize);
+		}
+	});
+
+	return bSucceeded;
+}
+
+bool IsKtx2TextureName(const string& textureName)
+{
+	const string filePath = GetTextureFilePath(textureName);
+
+	return filePath.size() >= 5 && filePath.compare(filePath.size() - 5, 5, ".ktx2") == 0;
+}
+
+string GetTextureFilePath(const string& textureName)
+{
+	return textureName.substr(0, textureName.find_first_of("#@"));
+}
+
+void UploadTextureArrayData(size_t dataOffset, const uint8_t* data, size_t dataSize)
+{
+	/*
+		ؽó ʹ ؽó ̿  ٷ ̾ ֱ    ٽ ø ˴ϴ.
+		 ؽó   簢θ ø  Ƿ  Ʒó ϴ.
+		  ߰ ϰų  κ  ¥ 簢,    ٵ 帶 ϳ 簢 øϴ.
+	*/
+	constexpr size_t rowDataSize = TEXTURE_ARRAY_WIDTH / 4 * ASTC_BLOCK_SIZE;
+	constexpr size_t rowCount = TEXTURE_ARRAY_HEIGHT / 4;
+
+	assert(dataOffset % ASTC_BLOCK_SIZE == 0 && dataSize % ASTC_BLOCK_SIZE == 0);
+
+	BindGlTexture(0, GL_TEXTURE_2D_ARRAY, TextureArray);
+
+	while (dataSize > 0)
+	{
+		const size_t layer = dataOffset / TEXTURE_ARRAY_AREA;
+		const size_t row = dataOffset % TEXTURE_ARRAY_AREA / rowDataSize;
+		const size_t column = dataOffset % rowDataSize;
+
+		size_t uploadSize = 0;
+		GLsizei width = 0;
+		GLsizei height = 0;
+
+		if (column != 0 || dataSize < rowDataSize)
+		{
+			uploadSize = std::min(rowDataSize - column, dataSize);
+			width = static_cast<GLsizei>(uploadSize / ASTC_BLOCK_SIZE * 4);
+			height = 4;
+		}
+		else
+		{
+			const size_t uploadRowCount = std::min(dataSize / rowDataSize, rowCount - row);
+
+			uploadSize = uploadRowCount * rowDataSize;
+			width = TEXTURE_ARRAY_WIDTH;
+			height = static_cast<GLsizei>(uploadRowCount * 4);
+		}
+
+		const GLint offsetX = static_cast<GLint>(column / ASTC_BLOCK_SIZE * 4);
+		const GLint offsetY = static_cast<GLint>(row * 4);
+
+		if (TextureArrayFormat == GL_RGBA8)
+		{
+			//  ػ RGBA8  ϳ 2x2 ؼ̹Ƿ    ͸   ٲ㼭 øϴ.
+			const GLsizei blockColumns = width / 4;
+			const GLsizei blockRows = height / 4;
+			std::vector<uint32_t> texels(static_cast<size_t>(blockColumns) * blockRows * 4);
+
+			for (GLsizei i = 0; i < blockRows * blockColumns; ++i)
+			{
+				const uint32_t* blockTexels = reinterpret_cast<const uint32_t*>(data + i * ASTC_BLOCK_SIZE);
+				uint32_t* destination = texels.data() + (i / blockColumns) * blockColumns * 4 + (i % blockColumns) * 2;
+
+				destination[0] = blockTexels[0];
+				destination[1] = blockTexels[1];
+				destination[blockColumns * 2] = blockTexels[2];
+				destination[blockColumns * 2 + 1] = blockTexels[3];
+			}
+
+			GL_CALL(glTexSubImage3D(
+				GL_TEXTURE_2D_ARRAY
+				, 0
+				, offsetX / 2
+				, offsetY / 2
+				, static_cast<GLint>(layer)
+				, width / 2
+				, height / 2
+				, 1
+				, GL_RGBA
+				, GL_UNSIGNED_BYTE
+				, texels.data()
+			));
+		}
+		else
+		{
+			GL_CALL(glCompressedTexSubImage3D(
+				GL_TEXTURE_2D_ARRAY
+				, 0
+				, offsetX
+				, offsetY
+				, static_cast<GLint>(layer)
+				, width
+				, height
+				, 1
+				, TextureArrayFormat
+				, static_cast<GLsizei>(uploadSize)
+				, reinterpret_cast<const void*>(data)
+			));
+		}
+
+		data += uploadSize;
+		dataOffset += uploadSize;
+		dataSize -= uploadSize;
+	}
+}
+
+void InitializeTextureWatcher()
+{
+	//  θ ϱ    ¸ մϴ. KTX2   ̸   ŰǷ ϸ   нϴ.
+	for (const auto& textureAttribute : TextureAttributes)
+	{
+		const string filePath = GetTextureFilePath(textureAttribute.first);
+		TextureFileState fileState;
+
+		if (TextureFileStates.count(filePath) == 0 && ReadTextureFileState(filePath, &fileState))
+		{
+			TextureFileStates[filePath] = fileState;
+		}
+	}
+
+#ifdef __linux__
+	TextureWatchHandle = inotify_init1(IN_NONBLOCK);
+	assert(TextureWatchHandle != -1 && "Failed to initialize inotify");
+
+	inotify_add_watch(TextureWatchHandle, RESOURCE_DIRECTORY, IN_CLOSE_WRITE | IN_MOVED_TO);
+#else
+	TextureWatchHandle = CreateFileA(RESOURCE_DIRECTORY, FILE_LIST_DIRECTORY, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE
+		, nullptr, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr);
+	assert(TextureWatchHandle != INVALID_HANDLE_VALUE && "Failed to watch the resource directory");
+
+	TextureWatchOverlapped.hEvent = CreateEventA(nullptr, TRUE, FALSE, nullptr);
+
+	RequestTextureDirectoryChanges();
+#endif
+}
+
+void UpdateTextureWatcher()
+{
+	/*
+		˸   ̸ ٲ ϸ ã  ϸ ؽø ϰ ٽ нϴ.
+		˸   ý ȣ   , ˸  (⿭ ħ)   Ȯմϴ.
+	*/
+	std::set<string> changedFilePaths;
+	bool bOverflowed = false;
+
+#ifdef __linux__
+	alignas(inotify_event) char events[4096];
+	ssize_t readSize = 0;
+
+	while ((readSize = read(TextureWatchHandle, events, sizeof(events))) > 0)
+	{
+		// ̺Ʈ ̸ ̸ŭ  ̷ ̾ ֽϴ.
+		for (ssize_t offset = 0; offset < readSize; )
+		{
+			const inotify_event* event = reinterpret_cast<const inotify_event*>(events + offset);
+
+			if ((event->mask & IN_Q_OVERFLOW) != 0)
+			{
+				bOverflowed = true;
+			}
+			else if (event->len > 0)
+			{
+				changedFilePaths.insert(RESOURCE_DIRECTORY + string(event->name));
+			}
+
+			offset += sizeof(inotify_event) + event->len;
+		}
+	}
+#else
+	DWORD readSize = 0;
+
+	if (GetOverlappedResult(TextureWatchHandle, &TextureWatchOverlapped, &readSize, FALSE) == FALSE)
+	{
+		return;
+	}
+
+	// ۰ ڶ ˸  0Ʈ ϴ.
+	bOverflowed = readSize == 0;
+
+	for (DWORD offset = 0; offset < readSize; )
+	{
+		const FILE_NOTIFY_INFORMATION* notifyInformation = reinterpret_cast<const FILE_NOTIFY_INFORMATION*>(TextureWatchBuffer + offset);
+		char fileName[MAX_PATH];
+
+		const int fileNameLength = WideCharToMultiByte(CP_ACP, 0, notifyInformation->FileName, static_cast<int>(notifyInformation->FileNameLength / sizeof(WCHAR))
+			, fileName, sizeof(fileName), nullptr, nullptr);
+
+		if (fileNameLength > 0)
+		{
+			changedFilePaths.insert(RESOURCE_DIRECTORY + string(fileName, fileNameLength));
+		}
+
+		if (notifyInformation->NextEntryOffset == 0)
+		{
+			break;
+		}
+
+		offset += notifyInformation->NextEntryOffset;
+	}
+
+	RequestTextureDirectoryChanges();
+#endif
+
+	if (bOverflowed)
+	{
+		for (const auto& textureFileState : TextureFileStates)
+		{
+			changedFilePaths.insert(textureFileState.first);
+		}
+	}
+
+	// ؽó ̸ ٽ ٰ ٸ      ٴ ˸ Բ ٽ õմϴ.
+	if (changedFilePaths.empty() == false)
+	{
+		changedFilePaths.insert(RetryTextureFilePaths.begin(), RetryTextureFilePaths.end());
+		RetryTextureFilePaths.clear();
+	}
+
+	for (const string& filePath : changedFilePaths)
+	{
+		// ؽó ƴ   ʽϴ.
+		const auto& foundTextureFileState = TextureFileStates.find(filePath);
+
+		if (foundTextureFileState == TextureFileStates.end())
+		{
+			continue;
+		}
+
+		TextureFileState fileState;
+
+		if (ReadTextureFileState(filePath, &fileState) == false
+			|| (fileState.Size == foundTextureFileState->second.Size && fileState.ContentHash == foundTextureFileState->second.ContentHash))
+		{
+			continue;
+		}
+
+		//   Ű ̸  ϴ. ٽ дٰ ؽó ̸   TextureAttributes ٲϴ.
+		std::vector<string> textureNames;
+
+		for (const auto& textureAttribute : TextureAttributes)
+		{
+			if (GetTextureFilePath(textureAttribute.first) == filePath)
+			{
+				textureNames.push_back(textureAttribute.first);
+			}
+		}
+
+		// ٽ    ״ ξ  ˸  ٽ õմϴ.
+		bool bReloaded = true;
+
+		for (const string& textureName : textureNames)
+		{
+			bReloaded = ReloadTexture(textureName) && bReloaded;
+		}
+
+		if (bReloaded)
+		{
+			foundTextureFileState->second = fileState;
+		}
+		else
+		{
+			RetryTextureFilePaths.insert(filePath);
+		}
+	}
+}
+
+#ifndef __linux__
+void RequestTextureDirectoryChanges()
+{
+	//   񵿱 ٸϴ.   hEvent ȣ  · ưϴ.
+	const BOOL bRequested = ReadDirectoryChangesW(TextureWatchHandle, TextureWatchBuffer, sizeof(TextureWatchBuffer), FALSE
+		, FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_SIZE, nullptr, &TextureWatchOverlapped, nullptr);
+
+	if (bRequested == FALSE)
+	{
+		assert(false && "Failed to read the resource directory changes");
+	}
+}
+#endif
+
+bool ReadTextureFileState(const string& filePath, TextureFileState* outState)
+{
+	assert(outState != nullptr);
+
+	FILE* textureFile = fopen(filePath.c_str(), "rb");
+
+	if (textureFile == nullptr)
+	{
+		return false;
+	}
+
+	//  ð   1 ȿ   ϸ  Ƿ ũ  ؽ÷ մϴ.
+	// ˸  ϸ Ƿ ɸ ð ٲ  ũ⿡ մϴ.
+	fseek(textureFile, 0, SEEK_END);
+	const long fileSize = ftell(textureFile);
+	fseek(textureFile, 0, SEEK_SET);
+
+	if (fileSize < 0)
+	{
+		fclose(textureFile);
+		return false;
+	}
+
+	auto fileData = std::make_unique<uint8_t[]>(static_cast<size_t>(fileSize));
+	const bool bRead = fileSize == 0 || fread(fileData.get(), static_cast<size_t>(fileSize), 1, textureFile) == 1;
+
+	fclose(textureFile);
+
+	if (bRead == false)
+	{
+		return false;
+	}
+
+	outState->Size = static_cast<uint64_t>(fileSize);
+	outState->ContentHash = HashData(fileData.get(), static_cast<size_t>(fileSize));
+
+	return true;
+}
+
+void ShutdownTextureWatcher()
+{
+#ifdef __linux__
+	if (TextureWatchHandle != -1)
+	{
+		close(TextureWatchHandle);
+		TextureWatchHandle = -1;
+	}
+#else
+	if (TextureWatchHandle != INVALID_HANDLE_VALUE)
+	{
+		// ۿ  û   ٸ ڿ ݽϴ.
+		DWORD readSize = 0;
+
+		CancelIo(TextureWatchHandle);
+		GetOverlappedResult(TextureWatchHandle, &TextureWatchOverlapped, &readSize, TRUE);
+
+		CloseHandle(TextureWatchOverlapped.hEvent);
+		CloseHandle(TextureWatchHandle);
+
+		TextureWatchOverlapped = {};
+		TextureWatchHandle = INVALID_HANDLE_VALUE;
+	}
+#endif
+
+	TextureFileStates.clear();
+	RetryTextureFilePaths.clear();
+}
+
+bool ReloadTexture(const string& fileName)
+{
+	const auto& foundTextureAttribute = TextureAttributes.find(fileName);
+
+	if (foundTextureAttribute == TextureAttributes.end())
+	{
+		return false;
+	}
+
+	uint32_t imageWidth = 0;
+	uint32_t imageHeight = 0;
+	size_t astcDataSize = 0;
+	unique_ptr<uint8_t[]> imageData = nullptr;
+	bool bRead = false;
+
+	// Ͱ    ̸    ֽϴ.  ˸  ٽ õմϴ.
+	if (IsKtx2TextureName(fileName))
+	{
+		std::list<Ktx2Image> ktx2Images(1);
+
+		if (LoadKtx2Image(fileName, &ktx2Images.front(), &imageWidth, &imageHeight))
+		{
+			astcDataSize = ktx2Images.front().DataSize;
+			ktx2Images.front().DataIndex = 0;
+
+			imageData = std::make_unique<uint8_t[]>(astcDataSize);
+			bRead = ReadKtx2Images(ktx2Images, imageData.get());
+		}
+	}
+	else
+	{
+		FILE* astcData = fopen(fileName.c_str(), "rb");
+
+		if (astcData != nullptr)
+		{
+			bRead = ReadAstcHeader(astcData, &imageWidth, &imageHeight, &astcDataSize);
+
+			if (bRead)
+			{
+				imageData = std::make_unique<uint8_t[]>(astcDataSize);
+				bRead = fread(imageData.get(), astcDataSize, 1, astcData) == 1;
+			}
+
+			fclose(astcData);
+		}
+	}
+
+	if (bRead == false)
+	{
+		fprintf(stderr, "Could not reload %s\n", fileName.c_str());
+		return false;
+	}
+
+	TextureAttribute& textureAttribute = foundTextureAttribute->second;
+	const size_t oldAstcDataSize = ((textureAttribute.Width + 3) / 4) * ((textureAttribute.Height + 3) / 4) * ASTC_BLOCK_SIZE;
+
+	//    ؽó ̸ ó ٽ ϴ.    ̶ ˴ϴ.
+	if (astcDataSize != oldAstcDataSize && UsedTextureArrayDataSize + astcDataSize > static_cast<size_t>(TEXTURE_ARRAY_AREA) * TextureArrayDepth)
+	{
+		return RebuildTextureAtlas();
+	}
+
+	const SpriteBlendMode blendMode = ClassifyTextureBlendMode(imageData.get(), imageWidth, imageHeight);
+	const uint32_t averageColor = ComputeTextureAverageColor(imageData.get(), imageWidth, imageHeight);
+
+	// ü   ̸ ٲ ؽó ȯմϴ. ũⰡ    ȯ̹Ƿ  ״Դϴ.
+	if (TextureArrayFormat != GL_COMPRESSED_RGBA_ASTC_4x4_KHR)
+	{
+		auto transcodedData = std::make_unique<uint8_t[]>(astcDataSize);
+		TranscodeTextureArrayData(imageData.get(), astcDataSize, transcodedData.get());
+
+		imageData = std::move(transcodedData);
+	}
+
+	//  常 ؽó Ӽ ٲٹǷ    ʰ ٲ  ޴ϴ.
+	std::lock_guard<std::mutex> textureAttributesLock(TextureAttributesMutex);
+
+	++TextureGeneration;
+
+	//  ũⰡ   ġ , ٸ    ڷ űϴ.
+	// ؽó  4  ؼ ̹Ƿ Ʈ  1/4Դϴ.
+	if (astcDataSize == oldAstcDataSize)
+	{
+		Backend->UploadTextureArrayData(textureAttribute.OffsetX * 4, imageData.get(), astcDataSize);
+		textureAttribute = MakeTextureAttribute(imageWidth, imageHeight, textureAttribute.OffsetX);
+		textureAttribute.BlendMode = blendMode;
+		textureAttribute.AverageColor = averageColor;
+	}
+	else
+	{
+		Backend->UploadTextureArrayData(UsedTextureArrayDataSize, imageData.get(), astcDataSize);
+		textureAttribute = MakeTextureAttribute(imageWidth, imageHeight, static_cast<uint32_t>(UsedTextureArrayDataSize / 4));
+		textureAttribute.BlendMode = blendMode;
+		textureAttribute.AverageColor = averageColor;
+		UsedTextureArrayDataSize += astcDataSize;
+	}
+
+	UpdateTextureArrayWasteSize();
+
+	return true;
+}
+
+void UpdateTextureArrayWasteSize()
+{
+	// ؼ ϳ 1Ʈ̹Ƿ 4ȼ  ø ũ  ũ ̰  Ǵ Ʈ Դϴ.
+	//  ε Ű     ʴ  ˴ϴ.
+	size_t paddingSize = 0;
+	size_t textureDataSize = 0;
+
+	for (const auto& textureAttribute : TextureAttributes)
+	{
+		const size_t paddedSize = static_cast<size_t>((textureAttribute.second.Width + 3) / 4) * ((textureAttribute.second.Height + 3) / 4) * ASTC_BLOCK_SIZE;
+
+		paddingSize += paddedSize - static_cast<size_t>(textureAttribute.second.Width) * textureAttribute.second.Height;
+		textureDataSize += paddedSize;
+	}
+
+	SetGpuMemoryTextureWaste(paddingSize, static_cast<size_t>(TEXTURE_ARRAY_AREA) * TextureArrayDepth - textureDataSize);
+}
+
+bool IsAstcSupported()
+{
+	return IsGlExtensionSupported("GL_KHR_texture_compression_astc_ldr")
+		|| IsGlExtensionSupported("GL_OES_texture_compression_astc");
+}
+
+GLenum SelectTextureArrayFormat()
+{
+	const char* forcedFormat = getenv(TEXTURE_FORMAT_ENVIRONMENT_VARIABLE);
+
+	if (forcedFormat != nullptr && forcedFormat[0] != '\0')
+	{
+		// Ʈ 鿣 ASTC Ǯ  Ƿ  ʽϴ.
+		if (Backend == &GetSoftwareRenderBackend())
+		{
+			fprintf(stderr, "%s is ignored by the software backend\n", TEXTURE_FORMAT_ENVIRONMENT_VARIABLE);
+		}
+		else if (strcmp(forcedFormat, "etc2") == 0)
+		{
+			return GL_COMPRESSED_RGBA8_ETC2_EAC;
+		}
+		else if (strcmp(forcedFormat, "rgba8") == 0)
+		{
+			return GL_RGBA8;
+		}
+		else
+		{
+			fprintf(stderr, "Unknown %s value: %s (expected etc2 or rgba8)\n", TEXTURE_FORMAT_ENVIRONMENT_VARIABLE, forcedFormat);
+		}
+	}
+
+	return Backend->IsAstcSupported() ? GL_COMPRESSED_RGBA_ASTC_4x4_KHR : FALLBACK_TEXTURE_FORMAT;
+}
+
+bool IsGlExtensionSupported(const char* extensionName)
+{
+	GLint extensionCount = 0;
+	GL_CALL(glGetIntegerv(GL_NUM_EXTENSIONS, &extensionCount));
+
+	for (GLint i = 0; i < extensionCount; ++i)
+	{
+		const char* extension = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, i));
+
+		if (strcmp(extension, extensionName) == 0)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void TranscodeTextureArrayData(const uint8_t* astcData, size_t dataSize, uint8_t* outData)
+{
+	/*
+		ؽó  ʹ 4x4   ̾ ̹Ƿ ϸ  ȯ  ֽϴ.
+		 ۾  ŭ  ۾  Ǯ ķ ȯϸ   ġ 16Ʈ մϴ.
+		̳ еó     찡  ٷ  ϰ  ȯ  մϴ.
+	*/
+	assert(dataSize % ASTC_BLOCK_SIZE == 0);
+
+	const size_t blockCount = dataSize / ASTC_BLOCK_SIZE;
+	const uint32_t chunkCount = GetJobThreadCount();
+	const size_t chunkBlockCount = (blockCount + chunkCount - 1) / chunkCount;
+
+	RunJobs(chunkCount, [=](uint32_t chunk)
+	{
+		const size_t beginBlock = std::min(chunk * chunkBlockCount, blockCount);
+		const size_t endBlock = std::min(beginBlock + chunkBlockCount, blockCount);
+
+		AstcBlockCache blockCache;
+		InitializeAstcBlockCache(&blockCache, 4, 4, 256);
+
+		for (size_t block = beginBlock; block < endBlock; ++block)
+		{
+			const uint8_t* sourceBlock = astcData + block * ASTC_BLOCK_SIZE;
+			uint8_t* destinationBlock = outData + block * ASTC_BLOCK_SIZE;
+
+			if (block > beginBlock && memcmp(sourceBlock, sourceBlock - ASTC_BLOCK_SIZE, ASTC_BLOCK_SIZE) == 0)
+			{
+				memcpy(destinationBlock, destinationBlock - ASTC_BLOCK_SIZE, ASTC_BLOCK_SIZE);
+				continue;
+			}
+
+			const uint8_t* texels = DecodeAstcBlockCached(&blockCache, sourceBlock);
+
+			if (TextureArrayFormat == GL_RGBA8)
+			{
+				// 2x2 ؼ    ػ ؼ 4 ϴ.
+				for (int y = 0; y < 2; ++y)
+				{
+					for (int x = 0; x < 2; ++x)
+					{
+						for (int channel = 0; channel < 4; ++channel)
+						{
+							const int texel = (y * 2 * 4 + x * 2) * 4 + channel;
+							const int sum = texels[texel] + texels[texel + 4] + texels[texel + 16] + texels[texel + 20];
+
+							destinationBlock[(y * 2 + x) * 4 + channel] = static_cast<uint8_t>((sum + 2) / 4);
+						}
+					}
+				}
+			}
+			else
+			{
+				EncodeEtc2RgbaBlock(texels, destinationBlock);
+			}
+		}
+	});
+}
+
+bool LoadTranscodedTextureArray(uint64_t sourceHash, uint8_t* outData, size_t dataSize)
+{
+	char cacheFilePath[256];
+	snprintf(cacheFilePath, sizeof(cacheFilePath), "%sTextureArray_%016llX_%04X.bin"
+		, TEXTURE_CACHE_DIRECTORY, static_cast<unsigned long long>(sourceHash), TextureArrayFormat);
+
+	FILE* cacheFile = fopen(cacheFilePath, "rb");
+
+	if (cacheFile == nullptr)
+	{
+		return false;
+	}
+
+	//   ʰų  ߷  ĳø ϰ ٽ ȯմϴ.
+	TextureArrayCacheHeader header;
+	const bool bValid = fread(&header, sizeof(header), 1, cacheFile) == 1
+		&& memcmp(header.Magic, "DCTA", sizeof(header.Magic)) == 0
+		&& header.Format == TextureArrayFormat
+		&& header.SourceHash == sourceHash
+		&& header.DataSize == dataSize
+		&& fread(outData, dataSize, 1, cacheFile) == 1;
+
+	fclose(cacheFile);
+
+	return bValid;
+}
+
+void SaveTranscodedTextureArray(uint64_t sourceHash, const uint8_t* data, size_t dataSize)
+{
+	CreateCacheDirectory(TEXTURE_CACHE_DIRECTORY);
+
+	char cacheFilePath[256];
+	snprintf(cacheFilePath, sizeof(cacheFilePath), "%sTextureArray_%016llX_%04X.bin"
+		, TEXTURE_CACHE_DIRECTORY, static_cast<unsigned long long>(sourceHash), TextureArrayFormat);
+
+	FILE* cacheFile = fopen(cacheFilePath, "wb");
+
+	if (cacheFile == nullptr)
+	{
+		fprintf(stderr, "Could not write %s\n", cacheFilePath);
+		return;
+	}
+
+	const TextureArrayCacheHeader header = { { 'D', 'C', 'T', 'A' }, TextureArrayFormat, sourceHash, dataSize };
+
+	fwrite(&header, sizeof(header), 1, cacheFile);
+	fwrite(data, dataSize, 1, cacheFile);
+	fclose(cacheFile);
+}
+
+uint64_t HashData(const uint8_t* data, size_t dataSize)
+{
+	// FNV-1a ؽԴϴ. ĳ Űθ ϹǷ   켱߽ϴ.
+	uint64_t hash = 0xCBF29CE484222325ull;
+
+	for (size_t i = 0; i < dataSize; ++i)
+	{
+		hash = (hash ^ data[i]) * 0x100000001B3ull;
+	}
+
+	return hash;
+}
+
+void CreateCacheDirectory(const char* directoryPath)
+{
+#ifdef __linux__
+	mkdir(directoryPath, 0755);
+#else
+	CreateDirectoryA(directoryPath, nullptr);
+#endif
+}
+
+GLuint BeginShaderProgram(const char* vertexShaderFilePath, const char* fragmentShaderFilePath, const char* defines)
+{
+	ShaderProgramBuild build = {};
+	build.VertexShaderSource = ReadShaderSource(vertexShaderFilePath, defines);
+	build.FragmentShaderSource = ReadShaderSource(fragmentShaderFilePath, defines);
+
+	// ҽ  ̹    ̳ʸ ״ մϴ.
+	build.ProgramHash = HashShaderProgram(build.VertexShaderSource, build.FragmentShaderSource);
+	build.ShaderProgram = LoadProgramBinary(build.ProgramHash);
+
+	if (build.ShaderProgram == 0)
+	{
+		build.ShaderProgram = GL_CALL(glCreateProgram());
+		CompileShaderProgram(&build);
+	}
+
+	const GLuint shaderProgram = build.ShaderProgram;
+	PendingShaderPrograms.push_back(std::move(build));
+
+	return shaderProgram;
+}
+
+void CompileShaderProgram(ShaderProgramBuild* build)
+{
+	assert(build != nullptr);
+
+	CompileShader(&build->VertexShader, GL_VERTEX_SHADER, build->VertexShaderSource);
+	CompileShader(&build->FragmentShader, GL_FRAGMENT_SHADER, build->FragmentShaderSource);
+
+	LinkShaderProgram(build->ShaderProgram, build->VertexShader, build->FragmentShader);
+}
+
+void FinishShaderProgram(GLuint shaderProgram)
+{
+	const auto& foundBuild = std::find_if(PendingShaderPrograms.begin(), PendingShaderPrograms.end()
+		, [shaderProgram](const ShaderProgramBuild& build) { return build.ShaderProgram == shaderProgram; });
+
+	if (foundBuild == PendingShaderPrograms.end())
+	{
+		return;
+	}
+
+	ShaderProgramBuild& build = *foundBuild;
+
+	// ũ   ⼭ ó    ٸϴ.
+	GLint bLinked = 0;
+	GL_CALL(glGetProgramiv(shaderProgram, GL_LINK_STATUS, &bLinked));
+
+	// ̹ ٲų ̳ʸ ջǾ źεǾ  α׷ ü ҽ ٽ մϴ.
+	if (bLinked == 0 && build.VertexShader == 0)
+	{
+		CompileShaderProgram(&build);
+		GL_CALL(glGetProgramiv(shaderProgram, GL_LINK_STATUS, &bLinked));
+	}
+
+	if (build.VertexShader != 0)
+	{
+		CheckShaderCompileStatus(build.VertexShader);
+		CheckShaderCompileStatus(build.FragmentShader);
+
+		GL_CALL(glDeleteShader(build.VertexShader));
+		GL_CALL(glDeleteShader(build.FragmentShader));
+
+		if (bLinked != 0)
+		{
+			SaveProgramBinary(build.ProgramHash, shaderProgram);
+		}
+	}
+
+	PendingShaderPrograms.erase(foundBuild);
+
+	ApplyTextureArrayUniforms(shaderProgram);
+
+	ApplyViewportSizeUniform(shaderProgram);
+}
+
+void PollShaderPrograms()
+{
+	// Ȯ     ͸ε ߹Ƿ ó ׸  ̷ϴ.
+	if (bParallelShaderCompileSupported == false)
+	{
+		return;
+	}
+
+	for (size_t i = 0; i < PendingShaderPrograms.size();)
+	{
+		const GLuint shaderProgram = PendingShaderPrograms[i].ShaderProgram;
+
+		GLint bCompleted = 0;
+		GL_CALL(glGetProgramiv(shaderProgram, GL_COMPLETION_STATUS_KHR, &bCompleted));
+
+		if (bCompleted != 0)
+		{
+			FinishShaderProgram(shaderProgram);
+		}
+		else
+		{
+			++i;
+		}
+	}
+}
+
+bool IsShaderProgramPending(GLuint shaderProgram)
+{
+	return std::any_of(PendingShaderPrograms.begin(), PendingShaderPrograms.end()
+		, [shaderProgram](const ShaderProgramBuild& build) { return build.ShaderProgram == shaderProgram; });
+}
+
+void ApplyTextureArrayUniforms(GLuint shaderProgram)
+{
+	const GLint uTexSamplerArrayID = GL_CALL(glGetUniformLocation(shaderProgram, "uTexArraySampler"));
+	GL_CALL(glProgramUniform1i(shaderProgram, uTexSamplerArrayID, 0));
+
+	const GLint uTexelShiftID = GL_CALL(glGetUniformLocation(shaderProgram, "uTexelShift"));
+	GL_CALL(glProgramUniform1i(shaderProgram, uTexelShiftID, TexelShift));
+}
+
+void ApplyViewportSizeUniform(GLuint shaderProgram)
+{
+	//  ̴ ũ⸦ ȼ ٲ  մϴ. ĳ ̾ ȭ  Ʈ ׸Ƿ ػ  ٲ  ٽ մϴ.
+	const GLint uViewportSizeID = GL_CALL(glGetUniformLocation(shaderProgram, "uViewportSize"));
+	GL_CALL(glProgramUniform2f(shaderProgram, uViewportSizeID, static_cast<float>(RenderWidth), static_cast<float>(RenderHeight)));
+}
+
+string ReadShaderSource(const char* shaderFilePath, const char* defines)
+{
+	FILE* shaderFile = fopen(shaderFilePath, "r");
+	assert(shaderFile != nullptr && "Failed to load shader");
+
+	// ̴  ũ⸦ ɴϴ.
+	fseek(shaderFile, 0, SEEK_END);
+	const uint32_t shaderFileSize = static_cast<uint32_t>(ftell(shaderFile));
+	rewind(shaderFile);
+
+	auto shaderSource = std::make_unique<char[]>(shaderFileSize);
+
+	// ؽƮ 忡 ٹٲ ȯǾ  ũ⺸    Ƿ   ̸ մϴ.
+	const size_t shaderSourceLength = fread(shaderSource.get(), 1, shaderFileSize, shaderFile);
+
+	fclose(shaderFile);
+
+	// #version  տ ־ ϹǷ defines ù    ֽϴ.
+	const char* data = shaderSource.get();
+	const char* firstLineEnd = static_cast<const char*>(memchr(data, '\n', shaderSourceLength));
+	const size_t firstLineLength = firstLineEnd != nullptr ? static_cast<size_t>(firstLineEnd - data + 1) : shaderSourceLength;
+
+	string source(data, firstLineLength);
+	source += defines;
+	source.append(data + firstLineLength, shaderSourceLength - firstLineLength);
+
+	return source;
+}
+
+void CompileShader(GLuint* shader, const GLenum type, const string& shaderSource)
+{
+	assert(shader != nullptr && "the shader must not be null");
+
+	const char* source = shaderSource.c_str();
+	const GLint sourceLength = static_cast<GLint>(shaderSource.size());
+
+	*shader = GL_CALL(glCreateShader(type));
+	GL_CALL(glShaderSource(*shader, 1, &source, &sourceLength));
+	GL_CALL(glCompileShader(*shader));
+}
+
+void CheckShaderCompileStatus(GLuint shader)
+{
+#ifdef _DEBUG //    ̴  ˻մϴ.    ߹Ƿ FinishShaderProgram ȣմϴ.
+	GLint bSuccess = 0;
+	GL_CALL(glGetShaderiv(shader, GL_COMPILE_STATUS, &bSuccess));
+
+	if (bSuccess == 0)
+	{
+		GLint logLength = 0;
+		GL_CALL(glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &logLength));
+
+		if (logLength > 0)
+		{
+			auto log = std::make_unique<char[]>(logLength);
+			GL_CALL(glGetShaderInfoLog(shader, logLength, nullptr, log.get()));
+
+			fprintf(stderr, "%s", log.get());
+			DEBUG_BREAK();
+		}
+	}
+#endif
+}
+
+void LinkShaderProgram(GLuint shaderProgram, GLuint vertexShader, GLuint fragmentShader)
+{
+	GL_CALL(glAttachShader(shaderProgram, vertexShader));
+	GL_CALL(glAttachShader(shaderProgram, fragmentShader));
+
+	// ũ  ̳ʸ   ֵ ũ  ˷ݴϴ.
+	GL_CALL(glProgramParameteri(shaderProgram, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE));
+	GL_CALL(glLinkProgram(shaderProgram));
+}
+
+uint64_t HashShaderProgram(const string& vertexShaderSource, const string& fragmentShaderSource)
+{
+	// α׷ ̳ʸ ̹ ٸ ̹ ƮǸ    Ƿ GL_RENDERER GL_VERSION Ű ֽϴ.
+	// (defines) ̹ ҽ  ֽϴ.
+	string programKey = vertexShaderSource;
+	programKey += '\0';
+	programKey += fragmentShaderSource;
+	programKey += '\0';
+	programKey += reinterpret_cast<const char*>(glGetString(GL_RENDERER));
+	programKey += '\0';
+	programKey += reinterpret_cast<const char*>(glGetString(GL_VERSION));
+
+	return HashData(reinterpret_cast<const uint8_t*>(programKey.data()), programKey.size());
+}
+
+GLuint LoadProgramBinary(uint64_t programHash)
+{
+	char cacheFilePath[256];
+	snprintf(cacheFilePath, sizeof(cacheFilePath), "%sProgram_%016llX.bin", PROGRAM_CACHE_DIRECTORY, static_cast<unsigned long long>(programHash));
+
+	FILE* cacheFile = fopen(cacheFilePath, "rb");
+
+	if (cacheFile == nullptr)
+	{
+		return 0;
+	}
+
+	//  ũ⸦  ؼ  ̳ʸ ũⰡ   ̿ ´ Ȯմϴ.
+	// ߸ų ջ ĳô ޸𸮸   źϰ մϴ.
+	fseek(cacheFile, 0, SEEK_END);
+	const long fileSize = ftell(cacheFile);
+	fseek(cacheFile, 0, SEEK_SET);
+
+	ProgramBinaryCacheHeader header;
+	bool bValid = fileSize >= static_cast<long>(sizeof(header))
+		&& fread(&header, sizeof(header), 1, cacheFile) == 1
+		&& memcmp(header.Magic, "DCPB", sizeof(header.Magic)) == 0
+		&& header.ProgramHash == programHash
+		&& header.BinarySize > 0
+		&& header.BinarySize <= MAX_PROGRAM_BINARY_SIZE
+		&& header.BinarySize == static_cast<uint64_t>(fileSize) - sizeof(header);
+
+	auto binary = std::make_unique<uint8_t[]>(bValid ? static_cast<size_t>(header.BinarySize) : 0);
+	bValid = bValid && fread(binary.get(), static_cast<size_t>(header.BinarySize), 1, cacheFile) == 1;
+
+	fclose(cacheFile);
+
+	if (bValid == false)
+	{
+		return 0;
+	}
+
+	const GLuint shaderProgram = GL_CALL(glCreateProgram());
+	glProgramBinary(shaderProgram, header.BinaryFormat, binary.get(), static_cast<GLsizei>(header.BinarySize));
+
+	//  ʴ ̸ glProgramBinary  Ƿ GL_CALL  ʰ ϴ.
+	// ̳ʸ źεǾ FinishShaderProgram ũ  Ȯմϴ.
+	while (glGetError() != GL_NO_ERROR)
+	{
+	}
+
+	return shaderProgram;
+}
+
+void SaveProgramBinary(uint64_t programHash, GLuint shaderProgram)
+{
+	// ̳ʸ  ϳ  ʴ ̹   ϴ.
+	GLint binaryFormatCount = 0;
+	GL_CALL(glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &binaryFormatCount));
+
+	GLint binarySize = 0;
+	GL_CALL(glGetProgramiv(shaderProgram, GL_PROGRAM_BINARY_LENGTH, &binarySize));
+
+	if (binaryFormatCount == 0 || binarySize == 0)
+	{
+		return;
+	}
+
+	auto binary = std::make_unique<uint8_t[]>(binarySize);
+	GLenum binaryFormat = 0;
+	GL_CALL(glGetProgramBinary(shaderProgram, binarySize, nullptr, &binaryFormat, binary.get()));
+
+	CreateCacheDirectory(PROGRAM_CACHE_DIRECTORY);
+
+	char cacheFilePath[256];
+	snprintf(cacheFilePath, sizeof(cacheFilePath), "%sProgram_%016llX.bin", PROGRAM_CACHE_DIRECTORY, static_cast<unsigned long long>(programHash));
+
+	FILE* cacheFile = fopen(cacheFilePath, "wb");
+
+	if (cacheFile == nullptr)
+	{
+		fprintf(stderr, "Could not write %s\n", cacheFilePath);
+		return;
+	}
+
+	const ProgramBinaryCacheHeader header = { { 'D', 'C', 'P', 'B' }, binaryFormat, programHash, static_cast<uint64_t>(binarySize) };
+
+	fwrite(&header, sizeof(header), 1, cacheFile);
+	fwrite(binary.get(), static_cast<size_t>(binarySize), 1, cacheFile);
+	fclose(cacheFile);
+}
+
+void SetInstanceAttributePointers(GLsizei firstInstance)
+{
+	// ProjectionViewWorldVBO  ̴ ˷ݴϴ.
+	BindGlBuffer(GL_ARRAY_BUFFER, ProjectionViewWorldVBO);
+
+	for (int i = 1; i <= 4; i++)
+	{
+		GL_CALL(glVertexAttribPointer(i, 4, GL_FLOAT, GL_FALSE, sizeof(mat4), reinterpret_cast<void*>(sizeof(mat4) * firstInstance + sizeof(vec4) * (i - 1))));
+	}
+
+	// TextureAttributeVBO  ̴ ˷ݴϴ.
+	// ؽó Ӽ  ״ ̴ ѱϴ. glVertexAttribPointer ϸ float ȯ˴ϴ.
+	BindGlBuffer(GL_ARRAY_BUFFER, TextureAttributeVBO);
+	GL_CALL(glVertexAttribIPointer(5, 4, GL_UNSIGNED_INT, sizeof(uvec4), reinterpret_cast<void*>(sizeof(uvec4) * firstInstance)));
+
+	// SpriteStyleVBO Ʈ ״ Ǯ ǹǷ  ѱϴ.
+	BindGlBuffer(GL_ARRAY_BUFFER, SpriteStyleVBO);
+	GL_CALL(glVertexAttribIPointer(6, 4, GL_UNSIGNED_INT, sizeof(uvec4), reinterpret_cast<void*>(sizeof(uvec4) * firstInstance)));
+}
+
+void WriteSpriteInstance(FramePacket* framePacket, GLsizei instance, int spriteIndex, const TextureAttribute& textureAttribute, bool bPointSprite)
+{
+	const Sprite& sprite = Sprites[spriteIndex];
+	const vec3 spritePosition = { sprite.X, sprite.Y, spriteIndex };
+
+	mat4& projectionViewWorld = framePacket->ProjectionViewWorlds[instance];
+	projectionViewWorld = translate(PROJECTION_VIEW, spritePosition);
+	projectionViewWorld = scale(projectionViewWorld, vec3(GetSpriteStyleSize(sprite.Style, textureAttribute.InstanceAttribute), 0.0f));
+
+	framePacket->TextureAttributes[instance] = textureAttribute.InstanceAttribute;
+	framePacket->SpriteStyles[instance] = bPointSprite ? MakeSpritePointStyle(sprite.Style, textureAttribute.AverageColor) : sprite.Style;
+	framePacket->SpriteIndices[instance] = static_cast<uint32_t>(spriteIndex);
+}
+
+void DrawSpriteInstances(GLsizei firstInstance, GLsizei instanceCount)
+{
+	if (instanceCount == 0)
+	{
+		return;
+	}
+
+	// OpenGLES 3.1  νϽ ϴ Լ Ƿ νϽ Ӽ  ġ Űܼ ׸ϴ.
+	SetInstanceAttributePointers(firstInstance);
+
+	GL_CALL(glDrawElementsInstanced(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0, instanceCount));
+}
+
+void DrawSpritePointInstances(GLsizei firstInstance, GLsizei instanceCount)
+{
+	if (instanceCount == 0)
+	{
+		return;
+	}
+
+	// νϽ  ϳ  ׸ϴ.  Ӽ  Ƿ ε  ׸ϴ.
+	SetInstanceAttributePointers(firstInstance);
+
+	GL_CALL(glDrawArraysInstanced(GL_POINTS, 0, 1, instanceCount));
+}
+
+bool IsPointSprite(const Sprite& sprite, const Material& material, const TextureAttribute& textureAttribute)
+{
+	// ؽó  ڸ   Ƿ ؽó    ʽϴ.
+	if (POINT_SPRITE_LOD == false
+		|| material.BlendMode != MATERIAL_BLEND_ALPHA || material.Layer == MATERIAL_LAYER_UI || (sprite.Style.z >> 24) < 255
+		|| GetSpriteStyleClipRect(sprite.Style) != 0)
+	{
+		return false;
+	}
+
+	//  ̹Ƿ   밢  Ʈ ũ⸦ ȭ ȼ ٲߴϴ. ȸ մϴ.
+	const vec2 pixelScale = vec2(PROJECTION_VIEW[0].x * SCREEN_WIDTH, PROJECTION_VIEW[1].y * SCREEN_HEIGHT) * 0.5f;
+	const vec2 pixelSize = abs(GetSpriteStyleSize(sprite.Style, textureAttribute.InstanceAttribute) * pixelScale);
+
+	return std::max(pixelSize.x, pixelSize.y) < PointSpriteLodSize;
+}
+
+uint16_t CreateMaterial(MaterialBlendMode blendMode, MaterialLayer layer, const vec4& tint)
+{
+	// Ƽ ȣ  Ű 16Ʈ ϴ.
+	assert(Materials.size() <= UINT16_MAX && "Too many materials");
+
+	Materials.push_back({ ShaderProgram, OpaqueShaderProgram, TextureArray, blendMode, layer, tint });
+
+	return static_cast<uint16_t>(Materials.size() - 1);
+}
+
+uint64_t GetSpriteSortKey(uint32_t cacheLayer, MaterialLayer layer, SpriteBlendMode pass, bool bPointSprite, uint16_t materialID)
+{
+	const uint64_t sortKey = (static_cast<uint64_t>(cacheLayer) << 21) | (static_cast<uint64_t>(layer) << 19) | (static_cast<uint64_t>(pass) << 17)
+		| (static_cast<uint64_t>(bPointSprite) << 16);
+
+	//  н Ƽ  Ƿ Ƽ ϴ Ʈ ۿ Ӵϴ.
+	return sortKey | (static_cast<uint64_t>(materialID) << (pass == SPRITE_BLEND_TRANSLUCENT ? 32 : 0));
+}
+
+void SetSpriteCacheLayer(int spriteIndex, uint32_t cacheLayer)
+{
+	assert(cacheLayer <= UNCACHED_LAYER);
+
+	Sprite& sprite = Sprites[spriteIndex];
+
+	if (sprite.CacheLayer == cacheLayer)
+	{
+		return;
+	}
+
+	MarkCacheLayerDirty(sprite.CacheLayer);
+	MarkCacheLayerDirty(cacheLayer);
+
+	sprite.CacheLayer = cacheLayer;
+}
+
+void SetSpriteStyle(int spriteIndex, float rotation, const vec2& pivot, bool bFlipX, bool bFlipY, const vec4& tint)
+{
+	// ġ ǹ ̴  ǹǷ ǹ ٲٸ Ʈ ϴ ڸ ٲϴ.
+	Sprite& sprite = Sprites[spriteIndex];
+	const uvec4 previousStyle = sprite.Style;
+
+	// Ŭ 簢, ׵θ, ũ  ϹǷ ״ Ӵϴ.
+	sprite.Style = PackSpriteStyle(rotation, pivot, bFlipX, bFlipY, tint);
+	sprite.Style.w = previousStyle.w;
+	SetSpriteStyleClipRect(&sprite.Style, GetSpriteStyleClipRect(previousStyle));
+	SetSpriteStyleNineSliceBorder(&sprite.Style, GetSpriteStyleNineSliceBorder(previousStyle));
+
+	MarkCacheLayerDirty(sprite.CacheLayer);
+}
+
+uint32_t CreateClipRect(const ScreenRect& rect)
+{
+	// Ŭ ȣ ŸϿ 8Ʈ ϴ.
+	assert(ClipRectCount < MAX_CLIP_RECT_COUNT && "Too many clip rects");
+
+	ClipRects[ClipRectCount] = rect;
+	MarkSceneDirty();
+
+	return ClipRectCount++;
+}
+
+void SetClipRect(uint32_t clipRect, const ScreenRect& rect)
+{
+	assert(clipRect != 0 && clipRect < ClipRectCount);
+
+	if (memcmp(&ClipRects[clipRect], &rect, sizeof(ScreenRect)) == 0)
+	{
+		return;
+	}
+
+	ClipRects[clipRect] = rect;
+
+	// ũ 並 űų ũ⸦ ٲ  ȣմϴ. ߸ Ʈ ִ ĳ ̾ ٽ ׷ ˴ϴ.
+	bool bLayersDirty[CACHED_LAYER_COUNT] = {};
+
+	for (const Sprite& sprite : Sprites)
+	{
+		if (sprite.CacheLayer < CACHED_LAYER_COUNT && GetSpriteStyleClipRect(sprite.Style) == clipRect)
+		{
+			bLayersDirty[sprite.CacheLayer] = true;
+		}
+	}
+
+	for (uint32_t layer = 0; layer < CACHED_LAYER_COUNT; ++layer)
+	{
+		if (bLayersDirty[layer])
+		{
+			MarkCacheLayerDirty(layer);
+		}
+	}
+
+	MarkSceneDirty();
+}
+
+void MoveScrollView(uint32_t scrollView, int32_t offsetY)
+{
+	assert(scrollView < SCROLL_VIEW_COUNT);
+
+	// 䰡 ȭ   ʵ ڸϴ. ٲ  SetClipRect ƹ͵  ʽϴ.
+	ScreenRect rect = ClipRects[ScrollViewClipRects[scrollView]];
+	rect.Y = std::min(std::max(rect.Y + offsetY, 0), SCREEN_HEIGHT - rect.Height);
+
+	SetClipRect(ScrollViewClipRects[scrollView], rect);
+}
+
+void SetSpriteClipRect(int spriteIndex, uint32_t clipRect)
+{
+	assert(clipRect < ClipRectCount);
+
+	Sprite& sprite = Sprites[spriteIndex];
+	SetSpriteStyleClipRect(&sprite.Style, clipRect);
+
+	MarkCacheLayerDirty(sprite.CacheLayer);
+}
+
+uint32_t CreateNineSliceBorder(uint16_t left, uint16_t right, uint16_t bottom, uint16_t top)
+{
+	// ׵θ  ؽó  Ƿ ؽó ũʹ SetSpriteNineSliceBorder մϴ.
+	// ׵θ ȣ ŸϿ 6Ʈ ϴ.
+	assert(NineSliceBorderCount < MAX_NINE_SLICE_BORDER_COUNT && "Too many nine-slice borders");
+
+	NineSliceBorders[NineSliceBorderCount] = { left, right, bottom, top };
+	MarkSceneDirty();
+
+	return NineSliceBorderCount++;
+}
+
+void SetSpriteSize(int spriteIndex, uint32_t width, uint32_t height)
+{
+	// 0̸   ؽó ũ ׸ϴ. ġ ״ ǹ ̴ Դϴ.
+	Sprite& sprite = Sprites[spriteIndex];
+	SetSpriteStyleSize(&sprite.Style, width, height);
+
+	MarkCacheLayerDirty(sprite.CacheLayer);
+}
+
+void SetSpriteNineSliceBorder(int spriteIndex, uint32_t border)
+{
+	assert(border < NineSliceBorderCount);
+
+	Sprite& sprite = Sprites[spriteIndex];
+
+	/*
+		 ׵θ Ʈ ؽó ũ  ø  Ƿ ޾Ƶ ʽϴ.
+		ؽó  ҷ ʾҰų  ε ۾ ̴ ׵θ ؽó ° ٿ ׸ϴ.
+	*/
+	if (border != 0)
+	{
+		std::lock_guard<std::mutex> textureAttributesLock(TextureAttributesMutex);
+
+		const auto textureAttribute = TextureAttributes.find(sprite.ImagePath);
+		const NineSliceBorder& borderSize = NineSliceBorders[border];
+
+		if (textureAttribute != TextureAttributes.end() && textureAttribute->second.Width > 0
+			&& (static_cast<uint32_t>(borderSize.Left) + borderSize.Right > textureAttribute->second.Width
+				|| static_cast<uint32_t>(borderSize.Bottom) + borderSize.Top > textureAttribute->second.Height))
+		{
+			assert(false && "Nine-slice border is larger than the sprite's texture");
+			return;
+		}
+	}
+	SetSpriteStyleNineSliceBorder(&sprite.Style, border);
+
+	MarkCacheLayerDirty(sprite.CacheLayer);
+}
+
+void MarkCacheLayerDirty(uint32_t cacheLayer)
+{
+	// ĳ ̾ ִ Ʈ ġ, ̹, Ƽ ٲٸ ȣؾ  ӿ ̾ ٽ ׷ϴ.
+	if (cacheLayer < CACHED_LAYER_COUNT)
+	{
+		++CacheLayerVersions[cacheLayer];
+	}
+
+	MarkSceneDirty();
+}
+
+void MarkSceneDirty()
+{
+	// Ʈ ī޶ ٲٸ ȣؾ  ӿ  Ŷ ϴ. ȣ     ׸ ʽϴ.
+	++SceneGeneration;
+}
+
+void CreateLayerTarget(uint32_t layer)
+{
+	// ȭ  ũ RGBA8 ؽó ׸ϴ. ռ  ؼ ȼ 1:1 մϴ.
+	GL_CALL(glGenTextures(1, &LayerTextures[layer]));
+	BindGlTexture(0, GL_TEXTURE_2D, LayerTextures[layer]);
+
+	GL_CALL(glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, SCREEN_WIDTH, SCREEN_HEIGHT));
+	GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST));
+	GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST));
+	TrackGpuMemoryAllocation(GPU_MEMORY_RENDER_TARGET, LayerTextures[layer], 4 * SCREEN_WIDTH * SCREEN_HEIGHT);
+
+	if (LayerDepthRenderbuffer == 0)
+	{
+		GL_CALL(glGenRenderbuffers(1, &LayerDepthRenderbuffer));
+		GL_CALL(glBindRenderbuffer(GL_RENDERBUFFER, LayerDepthRenderbuffer));
+		GL_CALL(glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, SCREEN_WIDTH, SCREEN_HEIGHT));
+		TrackGpuMemoryAllocation(GPU_MEMORY_RENDER_TARGET, LayerDepthRenderbuffer, 4 * SCREEN_WIDTH * SCREEN_HEIGHT);
+	}
+
+	GL_CALL(glGenFramebuffers(1, &LayerFramebuffers[layer]));
+	BindGlFramebuffer(LayerFramebuffers[layer]);
+
+	GL_CALL(glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, LayerTextures[layer], 0));
+	GL_CALL(glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, LayerDepthRenderbuffer));
+
+	assert(glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE && "Layer framebuffer is incomplete");
+}
+
+void ApplyMaterial(const SpriteDrawState& drawState)
+{
+	const Material& material = Materials[drawState.MaterialID];
+
+	GLuint shaderProgram = drawState.Pass == SPRITE_BLEND_OPAQUE ? material.OpaqueShaderProgram : material.ShaderProgram;
+
+	if (drawState.bPointSprites)
+	{
+		shaderProgram = PointShaderProgram;
+	}
+
+	const bool bBlend = drawState.Pass == SPRITE_BLEND_TRANSLUCENT;
+	const bool bDepthTest = drawState.bDepthTest;
+	const bool bDepthWrite = bBlend == false;
+
+	if (CurrentRenderState.ShaderProgram != shaderProgram)
+	{
+		// ó ϴ ̸ ⼭    ٸϴ.
+		FinishShaderProgram(shaderProgram);
+
+		CurrentRenderState.ShaderProgram = shaderProgram;
+		CurrentRenderState.MaterialID = -1;
+	}
+
+	UseGlProgram(shaderProgram);
+
+	if (CurrentRenderState.MaterialID != drawState.MaterialID)
+	{
+		const GLint uTintID = GL_CALL(glGetUniformLocation(shaderProgram, "uTint"));
+		GL_CALL(glUniform4fv(uTintID, 1, value_ptr(drawState.Tint)));
+		CurrentRenderState.MaterialID = drawState.MaterialID;
+	}
+
+	// ٲ ¸ ̹ ޵˴ϴ.
+	BindGlTexture(0, GL_TEXTURE_2D_ARRAY, material.TextureArray);
+	SetGlCapability(GL_BLEND, bBlend);
+
+	if (bBlend)
+	{
+		// Ĵ   ĳ ̾ Ƽö̵ ķ ̰ մϴ.    ٲ ʽϴ.
+		if (drawState.BlendMode == MATERIAL_BLEND_ADDITIVE)
+		{
+			SetGlBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE, GL_ZERO, GL_ONE);
+		}
+		else
+		{
+			SetGlBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+		}
+	}
+
+	SetGlCapability(GL_DEPTH_TEST, bDepthTest);
+	SetGlDepthMask(bDepthWrite);
+}
+
+void ResetRenderState()
+{
+	SetGlDepthMask(true);
 }